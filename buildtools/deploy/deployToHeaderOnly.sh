@@ -63,6 +63,8 @@ for i in \
     cluon/TCPConnection.hpp \
     cluon/TCPServer.hpp \
     cluon/ProtoConstants.hpp \
+    cluon/VarInt.hpp \
+    cluon/ProtoSizeVisitor.hpp \
     cluon/ToProtoVisitor.hpp \
     cluon/FromProtoVisitor.hpp \
     cluon/FromLCMVisitor.hpp \
@@ -100,6 +102,7 @@ for i in \
     UDPReceiver.cpp \
     TCPConnection.cpp \
     TCPServer.cpp \
+    ProtoSizeVisitor.cpp \
     ToProtoVisitor.cpp \
     FromProtoVisitor.cpp \
     FromLCMVisitor.cpp \
@@ -22,42 +22,111 @@
 
 namespace cluon {
 
+// Optional fields of an Envelope that are only encoded when set (i.e., != 0);
+// thus, Envelopes without them are encoded as before and decoders that are
+// unaware of them skip these fields.
+constexpr uint32_t ENVELOPE_SEQUENCENUMBER_FIELD{7};
+constexpr uint32_t ENVELOPE_SOURCEIDENTIFIER_FIELD{8};
+constexpr uint32_t ENVELOPE_NUMBEROFPARTITIONS_FIELD{9};
+constexpr uint32_t ENVELOPE_SHAREDMEMORYREFERENCE_FIELD{10};
+
+/**
+ * This class decodes an Envelope together with its optional sequence fields,
+ * the optional number of topic partitions of its sender, and the optional
+ * reference to its payload in the sender's cluon::SharedMemoryPool.
+ */
+class EnvelopeWithSequenceNumber {
+   public:
+    EnvelopeWithSequenceNumber(cluon::data::Envelope &envelope, uint32_t &sequenceNumber, uint32_t &sourceIdentifier) noexcept
+        : EnvelopeWithSequenceNumber(envelope, sequenceNumber, sourceIdentifier, m_ignoredNumberOfPartitions) {}
+
+    EnvelopeWithSequenceNumber(cluon::data::Envelope &envelope, uint32_t &sequenceNumber, uint32_t &sourceIdentifier, uint32_t &numberOfPartitions) noexcept
+        : EnvelopeWithSequenceNumber(envelope, sequenceNumber, sourceIdentifier, numberOfPartitions, m_ignoredSharedMemoryReference) {}
+    EnvelopeWithSequenceNumber(cluon::data::Envelope &envelope,
+                               uint32_t &sequenceNumber,
+                               uint32_t &sourceIdentifier,
+                               uint32_t &numberOfPartitions,
+                               uint64_t &sharedMemoryReference) noexcept
+        : m_envelope(envelope)
+        , m_sequenceNumber(sequenceNumber)
+        , m_sourceIdentifier(sourceIdentifier)
+        , m_numberOfPartitions(numberOfPartitions)
+        , m_sharedMemoryReference(sharedMemoryReference) {}
+
+    template <class Visitor>
+    inline void accept(uint32_t fieldId, Visitor &visitor) {
+        if (ENVELOPE_SEQUENCENUMBER_FIELD == fieldId) {
+            visitor.visit(fieldId, "uint32", "sequenceNumber", m_sequenceNumber);
+        } else if (ENVELOPE_SOURCEIDENTIFIER_FIELD == fieldId) {
+            visitor.visit(fieldId, "uint32", "sourceIdentifier", m_sourceIdentifier);
+        } else if (ENVELOPE_NUMBEROFPARTITIONS_FIELD == fieldId) {
+            visitor.visit(fieldId, "uint32", "numberOfPartitions", m_numberOfPartitions);
+        } else if (ENVELOPE_SHAREDMEMORYREFERENCE_FIELD == fieldId) {
+            visitor.visit(fieldId, "uint64", "sharedMemoryReference", m_sharedMemoryReference);
+        } else {
+            m_envelope.accept(fieldId, visitor);
+        }
+    }
+
+   private:
+    uint32_t m_ignoredNumberOfPartitions{0};
+    uint64_t m_ignoredSharedMemoryReference{0};
+    cluon::data::Envelope &m_envelope;
+    uint32_t &m_sequenceNumber;
+    uint32_t &m_sourceIdentifier;
+    uint32_t &m_numberOfPartitions;
+    uint64_t &m_sharedMemoryReference;
+};
+
 /**
  * This method transforms a given Envelope to a string representation to be
  * sent to an OpenDaVINCI session.
  *
  * @param envelope Envelope with payload to be sent.
+ * @param sequenceNumber Optional sequence number per (sourceIdentifier, dataType, senderStamp); 0 = not set.
+ * @param sourceIdentifier Optional identifier of the sender; only encoded together with a sequence number or a sharedMemoryReference.
+ * @param numberOfPartitions Optional number of topic partitions used by the sender; 0 = not set.
+ * @param sharedMemoryReference Optional reference to the payload in the sender's cluon::SharedMemoryPool; 0 = not set.
  * @return String representation of the Envelope to be sent to OpenDaVINCI v4.
  */
-inline std::string serializeEnvelope(cluon::data::Envelope &&envelope) noexcept {
+inline std::string serializeEnvelope(cluon::data::Envelope &&envelope,
+                                     uint32_t sequenceNumber        = 0,
+                                     uint32_t sourceIdentifier      = 0,
+                                     uint32_t numberOfPartitions    = 0,
+                                     uint64_t sharedMemoryReference = 0) noexcept {
+    // Encode the Envelope right behind the OD4 header into the same buffer.
+    constexpr std::size_t OD4_HEADER_SIZE{5};
     std::string dataToSend;
-    {
-        std::stringstream sstr;
+    try {
+        dataToSend.reserve(OD4_HEADER_SIZE + envelope.serializedData().size() + 64);
+        dataToSend.assign(OD4_HEADER_SIZE, '\0');
 
-        cluon::ToProtoVisitor protoEncoder;
+        cluon::ToProtoVisitor protoEncoder{dataToSend};
         envelope.accept(protoEncoder);
+        if (0 != sequenceNumber) {
+            protoEncoder.visit(ENVELOPE_SEQUENCENUMBER_FIELD, "uint32", "sequenceNumber", sequenceNumber);
+        }
+        if ((0 != sequenceNumber) || (0 != sharedMemoryReference)) {
+            protoEncoder.visit(ENVELOPE_SOURCEIDENTIFIER_FIELD, "uint32", "sourceIdentifier", sourceIdentifier);
+        }
+        if (0 != numberOfPartitions) {
+            protoEncoder.visit(ENVELOPE_NUMBEROFPARTITIONS_FIELD, "uint32", "numberOfPartitions", numberOfPartitions);
+        }
+        if (0 != sharedMemoryReference) {
+            protoEncoder.visit(ENVELOPE_SHAREDMEMORYREFERENCE_FIELD, "uint64", "sharedMemoryReference", sharedMemoryReference);
+        }
 
-        const std::string tmp{protoEncoder.encodedData()};
-        uint32_t length{static_cast<uint32_t>(tmp.size())};
+        uint32_t length{static_cast<uint32_t>(protoEncoder.size())};
         length <<= 8;
         length = htole32(length);
 
-        // Add OD4 header.
+        // Add OD4 header; the length occupies bytes 2-4 as byte 1 is overwritten.
         constexpr unsigned char OD4_HEADER_BYTE0 = 0x0D;
         constexpr unsigned char OD4_HEADER_BYTE1 = 0xA4;
-        sstr.put(static_cast<char>(OD4_HEADER_BYTE0));
-        auto posByte1 = sstr.tellp();
-        sstr.write(reinterpret_cast<char *>(&length), static_cast<std::streamsize>(sizeof(uint32_t)));
-        auto posByte5 = sstr.tellp();
-        sstr.seekp(posByte1);
-        sstr.put(static_cast<char>(OD4_HEADER_BYTE1));
-        sstr.seekp(posByte5);
-
-        // Write payload.
-        sstr.write(tmp.data(), static_cast<std::streamsize>(tmp.size()));
-
-        dataToSend = sstr.str();
-    }
+        std::memcpy(&dataToSend[1], &length, sizeof(uint32_t));
+        dataToSend[0] = static_cast<char>(OD4_HEADER_BYTE0);
+        dataToSend[1] = static_cast<char>(OD4_HEADER_BYTE1);
+    } catch (...) {} // LCOV_EXCL_LINE
     return dataToSend;
 }
 
@@ -70,10 +139,19 @@ inline std::string serializeEnvelope(cluon::data::Envelope &&envelope) noexcept
  * 0xA4 LEN0 LEN1 LEN2 are little Endian.
  *
  * @param in Stream to read from.
+ * @param sequenceNumber Optional sequence number of the Envelope; 0 if not set.
+ * @param sourceIdentifier Optional identifier of the Envelope's sender; 0 if not set.
+ * @param numberOfPartitions Optional number of topic partitions used by the Envelope's sender; 0 if not set.
+ * @param sharedMemoryReference Optional reference to the payload in the sender's cluon::SharedMemoryPool; 0 if not set.
  * @return cluon::data::Envelope.
  */
-inline std::pair<bool, cluon::data::Envelope> extractEnvelope(std::istream &in) noexcept {
+inline std::pair<bool, cluon::data::Envelope> extractEnvelope(
+    std::istream &in, uint32_t &sequenceNumber, uint32_t &sourceIdentifier, uint32_t &numberOfPartitions, uint64_t &sharedMemoryReference) noexcept {
     bool retVal{false};
+    sequenceNumber        = 0;
+    sourceIdentifier      = 0;
+    numberOfPartitions    = 0;
+    sharedMemoryReference = 0;
     cluon::data::Envelope env;
     if (in.good()) {
         constexpr uint8_t OD4_HEADER_SIZE{5};
@@ -109,9 +187,9 @@ inline std::pair<bool, cluon::data::Envelope> extractEnvelope(std::istream &in)
                 retVal = static_cast<int32_t>(LENGTH) == in.gcount();
 #endif
                 if (retVal) {
-                    std::stringstream sstr(std::string(buffer.begin(), buffer.begin() + static_cast<std::streamsize>(LENGTH)));
                     cluon::FromProtoVisitor protoDecoder;
-                    protoDecoder.decodeFrom(sstr, env);
+                    EnvelopeWithSequenceNumber envelopeWithSequenceNumber{env, sequenceNumber, sourceIdentifier, numberOfPartitions, sharedMemoryReference};
+                    protoDecoder.decodeFrom(buffer.data(), LENGTH, envelopeWithSequenceNumber);
                 }
             }
         }
@@ -119,19 +197,131 @@ inline std::pair<bool, cluon::data::Envelope> extractEnvelope(std::istream &in)
     return std::make_pair(retVal, env);
 }
 
+/**
+ * This method extracts an Envelope from the given istream that holds bytes in
+ * format:
+ *
+ *    0x0D 0xA4 LEN0 LEN1 LEN2 Proto-encoded cluon::data::Envelope
+ *
+ * 0xA4 LEN0 LEN1 LEN2 are little Endian.
+ *
+ * @param in Stream to read from.
+ * @param sequenceNumber Optional sequence number of the Envelope; 0 if not set.
+ * @param sourceIdentifier Optional identifier of the Envelope's sender; 0 if not set.
+ * @param numberOfPartitions Optional number of topic partitions used by the Envelope's sender; 0 if not set.
+ * @return cluon::data::Envelope.
+ */
+inline std::pair<bool, cluon::data::Envelope>
+extractEnvelope(std::istream &in, uint32_t &sequenceNumber, uint32_t &sourceIdentifier, uint32_t &numberOfPartitions) noexcept {
+    uint64_t sharedMemoryReference{0};
+    return extractEnvelope(in, sequenceNumber, sourceIdentifier, numberOfPartitions, sharedMemoryReference);
+}
+
+/**
+ * This method extracts an Envelope from the given istream that holds bytes in
+ * format:
+ *
+ *    0x0D 0xA4 LEN0 LEN1 LEN2 Proto-encoded cluon::data::Envelope
+ *
+ * 0xA4 LEN0 LEN1 LEN2 are little Endian.
+ *
+ * @param in Stream to read from.
+ * @param sequenceNumber Optional sequence number of the Envelope; 0 if not set.
+ * @param sourceIdentifier Optional identifier of the Envelope's sender; 0 if not set.
+ * @return cluon::data::Envelope.
+ */
+inline std::pair<bool, cluon::data::Envelope> extractEnvelope(std::istream &in, uint32_t &sequenceNumber, uint32_t &sourceIdentifier) noexcept {
+    uint32_t numberOfPartitions{0};
+    return extractEnvelope(in, sequenceNumber, sourceIdentifier, numberOfPartitions);
+}
+
+/**
+ * This method extracts an Envelope from the given istream that holds bytes in
+ * format:
+ *
+ *    0x0D 0xA4 LEN0 LEN1 LEN2 Proto-encoded cluon::data::Envelope
+ *
+ * 0xA4 LEN0 LEN1 LEN2 are little Endian.
+ *
+ * @param in Stream to read from.
+ * @return cluon::data::Envelope.
+ */
+inline std::pair<bool, cluon::data::Envelope> extractEnvelope(std::istream &in) noexcept {
+    uint32_t sequenceNumber{0};
+    uint32_t sourceIdentifier{0};
+    return extractEnvelope(in, sequenceNumber, sourceIdentifier);
+}
+
+/**
+ * This method extracts an Envelope from the given memory that holds bytes in
+ * format:
+ *
+ *    0x0D 0xA4 LEN0 LEN1 LEN2 Proto-encoded cluon::data::Envelope
+ *
+ * 0xA4 LEN0 LEN1 LEN2 are little Endian.
+ *
+ * @param data Pointer to the bytes to extract from.
+ * @param length Number of available bytes.
+ * @param sequenceNumber Optional sequence number of the Envelope; 0 if not set.
+ * @param sourceIdentifier Optional identifier of the Envelope's sender; 0 if not set.
+ * @param numberOfPartitions Optional number of topic partitions used by the Envelope's sender; 0 if not set.
+ * @param sharedMemoryReference Optional reference to the payload in the sender's cluon::SharedMemoryPool; 0 if not set.
+ * @return cluon::data::Envelope.
+ */
+inline std::pair<bool, cluon::data::Envelope> extractEnvelope(const char *data,
+                                                              std::size_t length,
+                                                              uint32_t &sequenceNumber,
+                                                              uint32_t &sourceIdentifier,
+                                                              uint32_t &numberOfPartitions,
+                                                              uint64_t &sharedMemoryReference) noexcept {
+    bool retVal{false};
+    sequenceNumber        = 0;
+    sourceIdentifier      = 0;
+    numberOfPartitions    = 0;
+    sharedMemoryReference = 0;
+    cluon::data::Envelope env;
+    constexpr std::size_t OD4_HEADER_SIZE{5};
+    if ((nullptr != data) && (OD4_HEADER_SIZE <= length) && (0x0D == static_cast<uint8_t>(data[0])) && (0xA4 == static_cast<uint8_t>(data[1]))) {
+        uint32_t header{0};
+        std::memcpy(&header, data + 1, sizeof(uint32_t));
+        const uint32_t LENGTH{le32toh(header) >> 8};
+        if ((retVal = (OD4_HEADER_SIZE + LENGTH <= length))) {
+            cluon::FromProtoVisitor protoDecoder;
+            EnvelopeWithSequenceNumber envelopeWithSequenceNumber{env, sequenceNumber, sourceIdentifier, numberOfPartitions, sharedMemoryReference};
+            protoDecoder.decodeFrom(data + OD4_HEADER_SIZE, LENGTH, envelopeWithSequenceNumber);
+        }
+    }
+    return std::make_pair(retVal, env);
+}
+
+/**
+ * This method extracts an Envelope from the given memory that holds bytes in
+ * format:
+ *
+ *    0x0D 0xA4 LEN0 LEN1 LEN2 Proto-encoded cluon::data::Envelope
+ *
+ * 0xA4 LEN0 LEN1 LEN2 are little Endian.
+ *
+ * @param data Pointer to the bytes to extract from.
+ * @param length Number of available bytes.
+ * @return cluon::data::Envelope.
+ */
+inline std::pair<bool, cluon::data::Envelope> extractEnvelope(const char *data, std::size_t length) noexcept {
+    uint32_t sequenceNumber{0};
+    uint32_t sourceIdentifier{0};
+    uint32_t numberOfPartitions{0};
+    uint64_t sharedMemoryReference{0};
+    return extractEnvelope(data, length, sequenceNumber, sourceIdentifier, numberOfPartitions, sharedMemoryReference);
+}
+
 /**
  * @return Extract a given Envelope's payload into the desired type.
  */
 template <typename T>
 inline T extractMessage(cluon::data::Envelope &&envelope) noexcept {
-    cluon::FromProtoVisitor decoder;
-
-    std::stringstream sstr(envelope.serializedData());
-    decoder.decodeFrom(sstr);
-
     T msg;
-    msg.accept(decoder);
-
+    cluon::FromProtoVisitor decoder;
+    decoder.decodeFrom(envelope.serializedData().data(), envelope.serializedData().size(), msg);
     return msg;
 }
 
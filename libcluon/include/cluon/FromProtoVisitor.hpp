@@ -11,19 +11,27 @@
 
 #include "cluon/ProtoConstants.hpp"
 #include "cluon/cluon.hpp"
-#include "cluon/any/any.hpp"
 
 #include <cstdint>
 #include <cstddef>
 #include <array>
-#include <sstream>
+#include <istream>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace cluon {
 /**
 This class decodes a given message from Proto format.
+
+Data can be decoded either from an std::istream or directly from memory; the
+latter avoids copying the data into a stream:
+
+\code{.cpp}
+std::string data{...}; // Proto-encoded MyMessage.
+MyMessage msg;
+cluon::FromProtoVisitor protoDecoder;
+protoDecoder.decodeFrom(data.data(), data.size(), msg);
+\endcode
 */
 class LIBCLUON_API FromProtoVisitor {
    private:
@@ -45,6 +53,15 @@ class LIBCLUON_API FromProtoVisitor {
      */
     void decodeFrom(std::istream &in) noexcept;
 
+    /**
+     * This method decodes Proto-encoded data from memory; the decoded values
+     * are copied so that data does not need to outlive this instance.
+     *
+     * @param data Pointer to the Proto-encoded data.
+     * @param length Length of the Proto-encoded data in bytes.
+     */
+    void decodeFrom(const char *data, std::size_t length) noexcept;
+
    public:
     // The following methods are provided to allow an instance of this class to
     // be used as visitor for an instance with the method signature void accept<T>(T&);
@@ -52,39 +69,43 @@ class LIBCLUON_API FromProtoVisitor {
     void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept;
     void postVisit() noexcept;
 
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept;
 
     template <typename T>
-    void visit(uint32_t &id, std::string &&typeName, std::string &&name, T &v) noexcept {
+    void visit(uint32_t &id, const char *typeName, const char *name, T &v) noexcept {
         (void)typeName;
         (void)name;
 
         if (m_callToDecodeFromWithDirectVisit) {
-            std::stringstream sstr{std::move(std::string(m_stringValue.data(), static_cast<std::size_t>(m_value)))};
-            cluon::FromProtoVisitor nestedProtoDecoder;
-            nestedProtoDecoder.decodeFrom(sstr, v);
-        }
-        else if (0 < m_mapOfKeyValues.count(id)) {
-            try {
-                std::stringstream sstr{linb::any_cast<std::string>(m_mapOfKeyValues[id])};
+            // The nested message is decoded in place from the source data; fields with another Proto type are skipped.
+            if ((ProtoConstants::LENGTH_DELIMITED == m_protoType) && (nullptr != m_lengthDelimitedData)) {
                 cluon::FromProtoVisitor nestedProtoDecoder;
-                nestedProtoDecoder.decodeFrom(sstr);
-                v.accept(nestedProtoDecoder);
-            } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+                nestedProtoDecoder.decodeFrom(m_lengthDelimitedData, static_cast<std::size_t>(m_value), v);
             }
         }
+        else if (const KeyValue *kv = keyValue(id, ProtoConstants::LENGTH_DELIMITED)) {
+            cluon::FromProtoVisitor nestedProtoDecoder;
+            nestedProtoDecoder.decodeFrom(m_lengthDelimitedValues.data() + kv->offset, kv->length);
+            v.accept(nestedProtoDecoder);
+        }
+    }
+
+    // Former visitor protocol passing type and field names as std::string.
+    template <typename T>
+    void visit(uint32_t id, std::string &&typeName, std::string &&name, T &v) noexcept {
+        visit(id, typeName.c_str(), name.c_str(), v);
     }
 
    public:
@@ -96,67 +117,103 @@ class LIBCLUON_API FromProtoVisitor {
      */
     template<typename T>
     void decodeFrom(std::istream &in, T &v) noexcept {
+        const std::string DATA{readFromStream(in)};
+        decodeFrom(DATA.data(), DATA.size(), v);
+    }
+
+    /**
+     * This method decodes Proto-encoded data from memory into corresponding
+     * fields of v. Strings and nested messages are read directly from data;
+     * decoding stops at the first field exceeding the given length.
+     *
+     * @param data Pointer to the Proto-encoded data.
+     * @param length Length of the Proto-encoded data in bytes.
+     * @param v Data structure to receive the decoded values.
+     */
+    template<typename T>
+    void decodeFrom(const char *data, std::size_t length, T &v) noexcept {
         m_callToDecodeFromWithDirectVisit = true;
-        while (in.good()) {
+        const char *end{data + length};
+        while (data < end) {
             // First stage: Read keyFieldType (encoded as VarInt).
-            if (0 < fromVarInt(in, m_keyFieldType)) {
-                // Succeeded to read keyFieldType entry; extract information.
-                m_protoType = static_cast<ProtoConstants>(m_keyFieldType & 0x7);
-                m_fieldId = static_cast<uint32_t>(m_keyFieldType >> 3);
-                switch (m_protoType) {
-                    case ProtoConstants::VARINT:
-                    {
-                        // Directly decode VarInt value.
-                        fromVarInt(in, m_value);
-                        v.accept(m_fieldId, *this);
-                    }
-                    break;
-                    case ProtoConstants::EIGHT_BYTES:
-                    {
-                        readBytesFromStream(in, sizeof(double), m_doubleValue.buffer.data());
-                        m_doubleValue.uint64Value = le64toh(m_doubleValue.uint64Value);
-                        v.accept(m_fieldId, *this);
-                    }
-                    break;
-                    case ProtoConstants::FOUR_BYTES:
-                    {
-                        readBytesFromStream(in, sizeof(float), m_floatValue.buffer.data());
-                        m_floatValue.uint32Value = le32toh(m_floatValue.uint32Value);
-                        v.accept(m_fieldId, *this);
-                    }
-                    break;
-                    case ProtoConstants::LENGTH_DELIMITED:
-                    {
-                        fromVarInt(in, m_value);
-                        const std::size_t BYTES_TO_READ_FROM_STREAM{static_cast<std::size_t>(m_value)};
-                        if (m_stringValue.capacity() < BYTES_TO_READ_FROM_STREAM) {
-                            m_stringValue.reserve(BYTES_TO_READ_FROM_STREAM);
-                        }
-                        readBytesFromStream(in, BYTES_TO_READ_FROM_STREAM, m_stringValue.data());
-                        v.accept(m_fieldId, *this);
-                    }
-                    break;
-                }
+            if (0 == fromVarInt(data, end, m_keyFieldType)) {
+                break;
+            }
+            // Succeeded to read keyFieldType entry; extract information.
+            m_protoType = static_cast<ProtoConstants>(m_keyFieldType & 0x7);
+            m_fieldId = static_cast<uint32_t>(m_keyFieldType >> 3);
+            if (!readValue(data, end)) {
+                break;
             }
+            v.accept(m_fieldId, *this);
         }
         m_callToDecodeFromWithDirectVisit = false;
     }
-
    private:
     int8_t fromZigZag8(uint8_t v) noexcept;
     int16_t fromZigZag16(uint16_t v) noexcept;
     int32_t fromZigZag32(uint32_t v) noexcept;
     int64_t fromZigZag64(uint64_t v) noexcept;
 
-    std::size_t fromVarInt(std::istream &in, uint64_t &value) noexcept;
+    /**
+     * This method decodes a VarInt from memory.
+     *
+     * @param data Pointer to the VarInt; advanced behind the VarInt.
+     * @param end End of the available data.
+     * @param value Decoded value.
+     * @return Bytes read or 0 if the VarInt exceeds the available data.
+     */
+    std::size_t fromVarInt(const char *&data, const char *end, uint64_t &value) noexcept;
+
+    /**
+     * This method decodes the value for m_protoType from memory.
+     *
+     * @param data Pointer to the value; advanced behind the value.
+     * @param end End of the available data.
+     * @return true if the value was decoded completely.
+     */
+    bool readValue(const char *&data, const char *end) noexcept;
 
-    void readBytesFromStream(std::istream &in, std::size_t bytesToReadFromStream, char *buffer) noexcept;
+    std::string readFromStream(std::istream &in) noexcept;
+
+   private:
+    // Decoded field for the map-based mode; values of fixed size are stored
+    // as their little endian bits, length-delimited values are stored in
+    // m_lengthDelimitedValues.
+    struct KeyValue {
+        uint32_t fieldId{0};
+        ProtoConstants protoType{ProtoConstants::VARINT};
+        uint64_t value{0};
+        uint32_t offset{0};
+        uint32_t length{0};
+    };
+
+    /**
+     * @param fieldId Field identifier to look up.
+     * @return Index of the decoded field in m_keyValues or -1 if it is missing.
+     */
+    int32_t indexOf(uint32_t fieldId) const noexcept;
+
+    /**
+     * @param fieldId Field identifier to look up.
+     * @param protoType Expected Proto type of the field.
+     * @return Decoded field or nullptr if it is missing or has a different type.
+     */
+    const KeyValue *keyValue(uint32_t fieldId, ProtoConstants protoType) const noexcept;
 
    private:
     // This Boolean flag indicates whether we consecutively decode from istream
     // and inject the decoded values directly into the receiving data structure.
     bool m_callToDecodeFromWithDirectVisit{false};
-    std::unordered_map<uint32_t, linb::any, UseUInt32ValueAsHashKey> m_mapOfKeyValues{};
+
+    // Decoded fields in the order of decoding; the containers are reused
+    // across calls to decodeFrom(...) to avoid allocations.
+    std::vector<KeyValue> m_keyValues{};
+    std::string m_lengthDelimitedValues{};
+    // Index into m_keyValues for dense field identifiers (-1 = missing);
+    // larger field identifiers are searched linearly.
+    static constexpr uint32_t MAX_DENSE_FIELD_ID{256};
+    std::vector<int32_t> m_indexOfFieldId{};
 
    private:
     // Fields necessary to decode from an istream.
@@ -176,8 +233,8 @@ class LIBCLUON_API FromProtoVisitor {
         float floatValue{0};
     } m_floatValue;
 
-    // Buffer for strings.
-    std::vector<char> m_stringValue;
+    // Strings and nested messages point into the data to decode from.
+    const char *m_lengthDelimitedData{nullptr};
 
     uint64_t m_keyFieldType{0};
     ProtoConstants m_protoType{ProtoConstants::VARINT};
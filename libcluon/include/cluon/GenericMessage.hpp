@@ -94,7 +94,7 @@ GenericMessage gm;
 
 std::stringstream buffer;
 gm.accept([](uint32_t, const std::string &, const std::string &) {},
-          [&buffer](uint32_t, std::string &&, std::string &&n, auto v) { buffer << n << " = " << v << std::endl; },
+          [&buffer](uint32_t, const char *, const char *n, auto v) { buffer << n << " = " << v << std::endl; },
           []() {});
 std::cout << buffer.str() << std::endl;
 \endcode
@@ -185,22 +185,22 @@ class LIBCLUON_API GenericMessage {
         void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept;
         void postVisit() noexcept;
 
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept;
 
         template <typename T>
-        void visit(uint32_t &id, std::string &&typeName, std::string &&name, T &value) noexcept {
+        void visit(uint32_t &id, const char *typeName, const char *name, T &value) noexcept {
             cluon::MetaMessage::MetaField mf;
             mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::MESSAGE_T).fieldDataTypeName(typeName).fieldName(name);
 
@@ -211,6 +211,12 @@ class LIBCLUON_API GenericMessage {
             m_metaMessage.add(std::move(mf));
         }
 
+        // Former visitor protocol passing type and field names as std::string.
+        template <typename T>
+        void visit(uint32_t id, std::string &&typeName, std::string &&name, T &value) noexcept {
+            visit(id, typeName.c_str(), name.c_str(), value);
+        }
+
        public:
         /**
          * @return MetaMessage for this GenericMessage.
@@ -272,22 +278,22 @@ class LIBCLUON_API GenericMessage {
     void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept;
     void postVisit() noexcept;
 
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept;
 
     template <typename T>
-    void visit(uint32_t &id, std::string &&typeName, std::string &&name, T &value) noexcept {
+    void visit(uint32_t &id, const char *typeName, const char *name, T &value) noexcept {
         (void)typeName;
         (void)name;
         if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -299,6 +305,12 @@ class LIBCLUON_API GenericMessage {
         }
     }
 
+    // Former visitor protocol passing type and field names as std::string.
+    template <typename T>
+    void visit(uint32_t id, std::string &&typeName, std::string &&name, T &value) noexcept {
+        visit(id, typeName.c_str(), name.c_str(), value);
+    }
+
    public:
     /**
      * This method allows other instances to visit this GenericMessage for
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_HISTOGRAM_HPP
+#define CLUON_HISTOGRAM_HPP
+
+#include "cluon/cluon.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace cluon {
+/**
+This class provides a lock-free histogram with logarithmically growing buckets
+(similar to HdrHistogram) to record non-negative values like latencies in
+microseconds. Values below 32 are recorded exactly; larger values are recorded
+with a relative precision of 1/16. Negative values are recorded as 0.
+
+Values can be recorded concurrently from several threads:
+
+\code{.cpp}
+cluon::Histogram h;
+h.record(120);
+h.record(80);
+int64_t median = h.percentile(50.0);
+\endcode
+*/
+class LIBCLUON_API Histogram {
+   private:
+    Histogram(const Histogram &) = delete;
+    Histogram(Histogram &&)      = delete;
+    Histogram &operator=(const Histogram &) = delete;
+    Histogram &operator=(Histogram &&) = delete;
+
+   public:
+    Histogram() noexcept;
+
+    /**
+     * This method records the given value.
+     *
+     * @param value Value to record.
+     */
+    void record(int64_t value) noexcept;
+
+    /**
+     * This method removes all recorded values.
+     */
+    void reset() noexcept;
+
+    /**
+     * @return Number of recorded values.
+     */
+    uint64_t count() const noexcept;
+
+    /**
+     * @return Smallest recorded value or 0 if no values were recorded.
+     */
+    int64_t min() const noexcept;
+
+    /**
+     * @return Largest recorded value or 0 if no values were recorded.
+     */
+    int64_t max() const noexcept;
+
+    /**
+     * @return Arithmetic mean of the recorded values or 0 if no values were recorded.
+     */
+    double mean() const noexcept;
+
+    /**
+     * @param p Percentile in [0, 100].
+     * @return Largest value equivalent to the given percentile within the precision of the buckets or 0 if no values were recorded.
+     */
+    int64_t percentile(double p) const noexcept;
+
+   private:
+    static std::size_t indexOf(uint64_t value) noexcept;
+    static uint64_t highestValueOf(std::size_t index) noexcept;
+
+   private:
+    static constexpr std::size_t SUB_BUCKETS{32};
+    static constexpr std::size_t HALF_SUB_BUCKETS{SUB_BUCKETS / 2};
+    static constexpr std::size_t NUMBER_OF_BUCKETS{SUB_BUCKETS + (64 - 5) * HALF_SUB_BUCKETS};
+
+    std::atomic<uint64_t> m_buckets[NUMBER_OF_BUCKETS];
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<uint64_t> m_sum{0};
+    std::atomic<int64_t> m_min{INT64_MAX};
+    std::atomic<int64_t> m_max{0};
+};
+} // namespace cluon
+
+#endif
@@ -31,6 +31,15 @@ class LIBCLUON_API MetaMessageToCPPTransformator {
     MetaMessageToCPPTransformator()                                      = default;
     MetaMessageToCPPTransformator(const MetaMessageToCPPTransformator &) = default;
 
+    /**
+     * Constructor.
+     *
+     * @param withProtoCodec If true, the generated messages additionally provide
+     *        protoSize(), encodeProto(), and decodeProto() to encode and decode
+     *        Proto format without a visitor.
+     */
+    explicit MetaMessageToCPPTransformator(bool withProtoCodec) noexcept;
+
     /**
      * The method is called from MetaMessage to visit itself using this transformator.
      *
@@ -46,6 +55,7 @@ class LIBCLUON_API MetaMessageToCPPTransformator {
    private:
     kainjow::mustache::data m_dataToBeRendered{};
     kainjow::mustache::data m_fields{kainjow::mustache::data::type::list};
+    bool m_withProtoCodec{false};
 };
 } // namespace cluon
 
@@ -9,6 +9,9 @@
 #ifndef CLUON_OD4SESSION_HPP
 #define CLUON_OD4SESSION_HPP
 
+#include "cluon/NotifyingPipeline.hpp"
+#include "cluon/SharedMemoryPool.hpp"
+#include "cluon/SharedMemoryRing.hpp"
 #include "cluon/Time.hpp"
 #include "cluon/ToProtoVisitor.hpp"
 #include "cluon/UDPReceiver.hpp"
@@ -16,14 +19,17 @@
 #include "cluon/cluon.hpp"
 #include "cluon/cluonDataStructures.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace cluon {
 /**
@@ -32,6 +38,52 @@ v4 session allows the automatic exchange of time-stamped Envelopes carrying
 user-defined messages usually using UDP multicast. A running OD4Session will not
 receive the bytes that itself has sent to other microservices.
 
+OD4Sessions that are running in the same process and that share the same CID
+exchange their Envelopes directly in memory: An Envelope sent from one of these
+sessions is neither serialized nor passed through the network stack for the
+other sessions in the same process but is handed over to their in-process
+queues instead; other processes still receive the Envelope via UDP multicast.
+
+OD4Sessions in different processes on the same host can additionally exchange
+their Envelopes via a host-local shared memory ring per CID, which also carries
+Envelopes that are larger than a UDP datagram. An OD4Session using this
+transport ignores the UDP multicast copies from local peers that are also
+using it and keeps receiving Envelopes from remote peers via UDP multicast:
+
+\code{.cpp}
+cluon::OD4Session od4{111};
+od4.enableSharedMemoryTransport();
+\endcode
+
+The shared memory transport is also enabled for all OD4Sessions when the
+environment variable CLUON_OD4SESSION_SHAREDMEMORY is set to 1.
+
+Large payloads like camera frames can be handed over to local peers without
+copying them through the ring: Payloads above a threshold are placed in a
+shared memory pool of the sending OD4Session and local peers receive only a
+small Envelope referencing the payload, which is resolved on arrival. Remote
+peers receive the complete Envelope via UDP multicast or nothing at all:
+
+\code{.cpp}
+cluon::OD4Session sender{111};
+sender.enableZeroCopyTransport(64 * 1024, 4, 8 * 1024 * 1024, cluon::OD4Session::RemoteFallback::DROP);
+
+cluon::OD4Session receiver{111};
+receiver.enableSharedMemoryTransport();
+receiver.dataTriggerZeroCopy(MyImage::ID(), [](const cluon::data::Envelope &envelope, const char *data, uint32_t size) {
+    // Decode or process the payload without copying it.
+});
+\endcode
+
+Envelopes for latency-critical message identifiers can be dispatched from a
+separate queue ahead of bulk data and can be sent with a DSCP mark (here:
+expedited forwarding):
+
+\code{.cpp}
+cluon::OD4Session od4{111};
+od4.setPriority(MyControlMessage::ID(), cluon::OD4Session::Priority::HIGH, 46);
+\endcode
+
 There are two ways to participate in an OpenDaVINCI session. Variant A is simply
 calling a user-supplied lambda whenever a new Envelope is received:
 
@@ -80,6 +132,33 @@ class LIBCLUON_API OD4Session {
     OD4Session &operator=(const OD4Session &) = delete;
     OD4Session &operator=(OD4Session &&) = delete;
 
+   public:
+    /**
+     * Policies to select the Envelopes to be delivered when limiting the
+     * rate of a data-triggered delegate.
+     */
+    enum class DecimationPolicy : uint8_t {
+        FIRST_IN_WINDOW = 0, // First Envelope in every time window of length 1/freq.
+        LAST_IN_WINDOW  = 1, // Latest Envelope at the end of every time window of length 1/freq.
+        EVENLY_SPACED   = 2, // Envelopes that are at least 1/freq apart on average.
+    };
+
+    /**
+     * Priority classes to dispatch received Envelopes.
+     */
+    enum class Priority : uint8_t {
+        NORMAL = 0, // Envelopes are dispatched in the order of their arrival.
+        HIGH   = 1, // Envelopes are dispatched from a separate queue ahead of bulk data.
+    };
+
+    /**
+     * Handling of remote peers for payloads sent via the zero-copy transport.
+     */
+    enum class RemoteFallback : uint8_t {
+        FULL = 0, // Remote peers receive the complete Envelope via UDP multicast.
+        DROP = 1, // Envelopes with large payloads are only sent to local peers.
+    };
+
    public:
     /**
      * Constructor.
@@ -91,6 +170,7 @@ class LIBCLUON_API OD4Session {
      *        to have both: a delegate for "catch-all" and the data-triggered ones.
      */
     OD4Session(uint16_t CID, std::function<void(cluon::data::Envelope &&envelope)> delegate = nullptr) noexcept;
+    ~OD4Session() noexcept;
 
     /**
      * This method will send a given Envelope to this OpenDaVINCI v4 session.
@@ -101,7 +181,9 @@ class LIBCLUON_API OD4Session {
 
     /**
      * This method sets a delegate to be called data-triggered on arrival
-     * of a new Envelope for a given message identifier.
+     * of a new Envelope for a given message identifier. On Linux, Envelopes
+     * for message identifiers without delegate are dropped by a socket
+     * filter in the kernel unless the monitor is enabled.
      *
      * @param messageIdentifier Message identifier to assign a delegate.
      * @param delegate Function to call on newly arriving Envelopes; setting it to nullptr will erase it.
@@ -109,6 +191,178 @@ class LIBCLUON_API OD4Session {
      */
     bool dataTrigger(int32_t messageIdentifier, std::function<void(cluon::data::Envelope &&envelope)> delegate) noexcept;
 
+    /**
+     * This method sets a delegate to be called data-triggered on arrival of
+     * a new Envelope for a given message identifier with at most the given
+     * frequency per senderStamp. All other Envelopes are dropped before they
+     * are handed to the delegate and thus, before their payload is decoded.
+     * With DecimationPolicy::LAST_IN_WINDOW, the delegate is called from a
+     * separate thread at the end of every time window.
+     *
+     * @param messageIdentifier Message identifier to assign a delegate.
+     * @param freq Maximum frequency in Hertz per senderStamp to call the delegate; 0 to not limit the frequency.
+     * @param policy Policy to select the Envelopes to be delivered.
+     * @param delegate Function to call on newly arriving Envelopes; setting it to nullptr will erase it.
+     * @return true if the given delegate could be successfully set or unset.
+     */
+    bool dataTrigger(int32_t messageIdentifier,
+                     float freq,
+                     DecimationPolicy policy,
+                     std::function<void(cluon::data::Envelope &&envelope)> delegate) noexcept;
+
+    /**
+     * This method sets a delegate to be called data-triggered with only the
+     * latest Envelope for a given message identifier: For every senderStamp,
+     * a newly arriving Envelope replaces the one that is still waiting to be
+     * delivered. The delegate is called from a separate thread so that a slow
+     * delegate neither delays other delegates nor processes stale Envelopes.
+     *
+     * @param messageIdentifier Message identifier to assign a delegate.
+     * @param delegate Function to call with the latest Envelope; setting it to nullptr will erase it.
+     * @return true if the given delegate could be successfully set or unset.
+     */
+    bool dataTriggerLatest(int32_t messageIdentifier, std::function<void(cluon::data::Envelope &&envelope)> delegate) noexcept;
+
+    /**
+     * This method sets a delegate to be called data-triggered with a view on
+     * the payload of a new Envelope for a given message identifier instead of
+     * its serializedData. Payloads from local peers using the zero-copy
+     * transport are passed directly from their shared memory pool; the view
+     * is only valid while the delegate runs and the delegate is called from
+     * the thread reading from the shared memory transport. Payloads of all
+     * other Envelopes are passed from their serializedData.
+     *
+     * @param messageIdentifier Message identifier to assign a delegate.
+     * @param delegate Function to call with the Envelope (without serializedData) and its payload; setting it to nullptr will erase it.
+     * @return true if the given delegate could be successfully set or unset.
+     */
+    bool dataTriggerZeroCopy(int32_t messageIdentifier,
+                             std::function<void(const cluon::data::Envelope &envelope, const char *data, uint32_t size)> delegate) noexcept;
+
+    /**
+     * @param messageIdentifier Message identifier with a delegate set by dataTriggerLatest or with DecimationPolicy::LAST_IN_WINDOW.
+     * @return Number of Envelopes that were replaced by newer ones before being delivered.
+     */
+    uint64_t numberOfConflatedEnvelopes(int32_t messageIdentifier) noexcept;
+
+    /**
+     * This method assigns a priority class to a given message identifier.
+     * Once a priority class was assigned, received Envelopes are dispatched
+     * from two queues with a thread each: One for Envelopes with
+     * Priority::HIGH and one for all other Envelopes. Thus, slow delegates
+     * for bulk data do not delay the delegates for Envelopes with high
+     * priority; however, delegates for different priority classes may be
+     * called concurrently. Optionally, Envelopes with the given message
+     * identifier that are sent via UDP multicast from this OD4Session are
+     * marked with the given DSCP and a raised socket priority.
+     *
+     * @param messageIdentifier Message identifier to assign a priority class.
+     * @param priority Priority class.
+     * @param dscp Differentiated Services Code Point [0 .. 63] to mark sent Envelopes with (0 = unmarked, 46 = expedited forwarding).
+     * @return true if the priority class could be assigned.
+     */
+    bool setPriority(int32_t messageIdentifier, Priority priority, uint8_t dscp = 0) noexcept;
+
+    /**
+     * This method enables topic partitioning: Instead of sending all Envelopes
+     * to the single multicast group 225.0.0.CID, Envelopes are sent to one of
+     * numberOfPartitions multicast groups determined by their dataType (cf.
+     * multicastGroup). This OD4Session joins only the groups of the
+     * partitions that it has delegates for so that switches and network
+     * interfaces can drop all other Envelopes. All peers using topic
+     * partitioning need to use the same number of partitions.
+     *
+     * Peers without topic partitioning (single-group peers) keep working:
+     * The single group is still joined to receive their Envelopes, and
+     * while such peers are sending, copies of all Envelopes sent from this
+     * OD4Session are sent to the single group as well. As peers that only
+     * receive cannot be detected, copies can be sent unconditionally.
+     * Topic partitioning is also enabled when the environment variable
+     * CLUON_OD4SESSION_PARTITIONS is set to the number of partitions.
+     *
+     * @param numberOfPartitions Number of partitions [1 .. 255].
+     * @param sendToSingleGroup If true, copies of all Envelopes are always sent to the single group.
+     * @return true if topic partitioning is enabled with the given number of partitions.
+     */
+    bool enableTopicPartitioning(uint8_t numberOfPartitions, bool sendToSingleGroup = false) noexcept;
+
+    /**
+     * @param CID OpenDaVINCI v4 session identifier [1 .. 254].
+     * @param dataType dataType of an Envelope.
+     * @param numberOfPartitions Number of partitions; 0 for the single group.
+     * @return Numerical IPv4 multicast address for Envelopes with the given dataType: 225.1.(dataType mod numberOfPartitions).CID or 225.0.0.CID.
+     */
+    static std::string multicastGroup(uint16_t CID, int32_t dataType, uint8_t numberOfPartitions) noexcept;
+
+    /**
+     * This method enables the exchange of Envelopes with other processes on
+     * the same host via a shared memory ring for this CID. Envelopes sent from
+     * this OD4Session are placed in the ring and are still sent via UDP
+     * multicast for remote peers; Envelopes received via UDP multicast from
+     * local peers that are using the ring as well are ignored. When the ring
+     * for this CID exists already, its layout is used. The ring is removed
+     * when the last OD4Session using it ends, not when its creator ends.
+     *
+     * @param numberOfSlots Number of Envelopes that the ring can hold.
+     * @param slotSize Maximum size of a serialized Envelope in the ring; it is at least the maximum size of a UDP datagram.
+     * @return true if the shared memory transport is enabled.
+     */
+    bool enableSharedMemoryTransport(uint32_t numberOfSlots = 64, uint32_t slotSize = 65535) noexcept;
+
+    /**
+     * This method enables the zero-copy transport for large payloads on top
+     * of the shared memory transport, which is enabled if necessary: Payloads
+     * of Envelopes sent from this OD4Session with at least threshold bytes are
+     * placed in a shared memory pool of this OD4Session and local peers
+     * receive a small Envelope referencing the payload via the shared memory
+     * ring. Slots of the pool are reused once every local peer that received
+     * the reference has accessed the payload or has stopped for at least
+     * cluon::SharedMemoryPool::HEARTBEAT_TIMEOUT; payloads that do not fit
+     * into the pool or find no free slot are sent as before. Receivers with
+     * an enabled monitor count references to payloads that were not
+     * accessible anymore as lost Envelopes.
+     *
+     * @param threshold Minimum size of the serializedData to use the pool.
+     * @param numberOfSlots Number of payloads that the pool can hold.
+     * @param slotSize Maximum size of a payload in the pool.
+     * @param fallback Handling of remote peers for payloads placed in the pool.
+     * @return true if the zero-copy transport is enabled.
+     */
+    bool enableZeroCopyTransport(uint32_t threshold     = 64 * 1024,
+                                 uint32_t numberOfSlots = 4,
+                                 uint32_t slotSize      = 8 * 1024 * 1024,
+                                 RemoteFallback fallback = RemoteFallback::FULL) noexcept;
+
+    /**
+     * This method enables the monitoring of all received Envelopes: For every
+     * pair (dataType, senderStamp), histograms of the transport latency
+     * (received - sent), of the sample age (received - sampleTimeStamp), and
+     * of the inter-arrival jitter are recorded together with the average
+     * rate. Envelopes from senders that called enableSequenceNumbers() are
+     * used to count lost, duplicated, and reordered Envelopes received via
+     * the network or shared memory. Optionally, the current statistics are
+     * sent periodically as cluon::data::EnvelopeStatistics to this
+     * OpenDaVINCI v4 session.
+     *
+     * @param freq Frequency in Hertz to send the statistics; 0 to not send them.
+     */
+    void enableMonitor(float freq = 0.0f) noexcept;
+
+    /**
+     * This method enables sequence numbers per (dataType, senderStamp) for
+     * all Envelopes sent from this OD4Session afterwards. Receivers with an
+     * enabled monitor use them to detect lost, duplicated, and reordered
+     * Envelopes. The sequence number and an identifier of this OD4Session
+     * add up to 12 bytes to every Envelope; thus, the maximum payload that
+     * fits into one UDP packet shrinks accordingly.
+     */
+    void enableSequenceNumbers() noexcept;
+
+    /**
+     * @return Statistics for all pairs (dataType, senderStamp) received since the monitor was enabled.
+     */
+    std::vector<cluon::data::EnvelopeStatistics> statistics() noexcept;
+
     /**
      * This method sets a delegate to be called time-triggered using the
      * specified frequency until the delegate returns false. This method
@@ -152,19 +406,96 @@ class LIBCLUON_API OD4Session {
     bool isRunning() noexcept;
 
    private:
-    void callback(std::string &&data, std::string &&from, std::chrono::system_clock::time_point &&timepoint) noexcept;
-    void sendInternal(std::string &&dataToSend) noexcept;
+    void callback(std::string &&data, std::string &&from, std::chrono::system_clock::time_point &&timepoint, bool isFromPartitionGroup) noexcept;
+    void dispatch(cluon::data::Envelope &&envelope, uint32_t sequenceNumber = 0, uint32_t sourceIdentifier = 0) noexcept;
+    void deliver(cluon::data::Envelope &&envelope, bool isHighPriority) noexcept;
+    void sendInternal(std::string &&dataToSend, uint8_t dscp = 0) noexcept;
+    void sendInProcess(const cluon::data::Envelope &envelope) noexcept;
+    void readFromSharedMemoryRing() noexcept;
+    void dispatchFromSharedMemoryPool(cluon::data::Envelope &&envelope, uint64_t reference, uint32_t sequenceNumber, uint32_t sourceIdentifier) noexcept;
+    void updateSubscriptions() noexcept;
+    void updatePartitions() noexcept;
+    void updateSocketFilter() noexcept;
+    void monitor(const cluon::data::Envelope &envelope, uint32_t sequenceNumber, uint32_t sourceIdentifier, bool isLost = false) noexcept;
+    bool setConflatingDelegate(int32_t messageIdentifier, int64_t period, std::function<void(cluon::data::Envelope &&envelope)> delegate) noexcept;
 
    private:
+    uint16_t m_CID{0};
     std::unique_ptr<cluon::UDPReceiver> m_receiver;
-    cluon::UDPSender m_sender;
+
+    // Socket filter to drop Envelopes without delegate in the kernel.
+    std::mutex m_socketFilterMutex{};
+
+    // Topic partitioning: One multicast group per partition of dataTypes.
+    std::atomic<uint8_t> m_numberOfPartitions{0};
+    std::atomic<bool> m_sendToSingleGroup{false};
+    std::atomic<int64_t> m_lastSingleGroupPeer{0};
+    std::mutex m_partitionReceiversMutex{};
+    std::unordered_map<uint8_t, std::unique_ptr<cluon::UDPReceiver>> m_partitionReceivers{};
+    std::shared_ptr<cluon::UDPSender> m_sender;
+
+    // Queue to receive Envelopes from other OD4Sessions with the same CID in this process.
+    std::shared_ptr<cluon::NotifyingPipeline<cluon::data::Envelope>> m_inProcessPipeline{};
+
+    // Host-local shared memory transport to exchange Envelopes with other processes.
+    std::unique_ptr<cluon::SharedMemoryRing> m_sharedMemoryRing{nullptr};
+    std::atomic<bool> m_sharedMemoryRingActive{false};
+    std::atomic<bool> m_sharedMemoryRingThreadRunning{false};
+    std::thread m_sharedMemoryRingThread{};
+    std::mutex m_sharedMemoryRingMutex{};
+
+    // Zero-copy transport for large payloads via a shared memory pool of this OD4Session.
+    std::unique_ptr<cluon::SharedMemoryPool> m_sharedMemoryPool{nullptr};
+    std::atomic<bool> m_sharedMemoryPoolActive{false};
+    std::mutex m_sharedMemoryPoolMutex{};
+    uint32_t m_zeroCopyThreshold{0};
+    RemoteFallback m_remoteFallback{RemoteFallback::FULL};
+    // Pools of local peers per sourceIdentifier; only used from the thread reading from the shared memory ring.
+    std::unordered_map<uint32_t, std::unique_ptr<cluon::SharedMemoryPool>, UseUInt32ValueAsHashKey> m_attachedSharedMemoryPools{};
+    uint64_t m_numberOfLostSharedMemoryPayloads{0};
+
+    // Monitor to record statistics about received Envelopes per (dataType, senderStamp).
+    struct StreamMonitor;
+    std::atomic<bool> m_monitorEnabled{false};
+    std::mutex m_monitorMutex{};
+    std::unordered_map<uint64_t, std::shared_ptr<StreamMonitor>> m_mapOfStreamMonitors{};
+    std::atomic<bool> m_monitorThreadRunning{false};
+    std::thread m_monitorThread{};
 
     std::mutex m_senderMutex{};
 
+    // Optional sequence numbers per (dataType, senderStamp) for Envelopes sent from this OD4Session.
+    uint32_t m_sourceIdentifier{0};
+    std::atomic<bool> m_sequenceNumbersEnabled{false};
+    std::mutex m_sequenceNumbersMutex{};
+    std::unordered_map<uint64_t, uint32_t> m_sequenceNumbers{};
+
+    // Priority classes and DSCP marks per message identifier.
+    std::atomic<bool> m_priorityClassesEnabled{false};
+    std::mutex m_mapOfPrioritiesMutex{};
+    std::unordered_map<int32_t, std::pair<Priority, uint8_t>, UseUInt32ValueAsHashKey> m_mapOfPriorities{};
+    std::shared_ptr<cluon::NotifyingPipeline<cluon::data::Envelope>> m_highPriorityPipeline{};
+    std::shared_ptr<cluon::NotifyingPipeline<cluon::data::Envelope>> m_normalPriorityPipeline{};
+
+    // Delegates are called while holding the mutex of their priority class.
+    std::mutex m_delegateMutex{};
+    std::mutex m_highPriorityDelegateMutex{};
     std::function<void(cluon::data::Envelope &&envelope)> m_delegate{nullptr};
 
     std::mutex m_mapOfDataTriggeredDelegatesMutex{};
     std::unordered_map<int32_t, std::function<void(cluon::data::Envelope &&envelope)>, UseUInt32ValueAsHashKey> m_mapOfDataTriggeredDelegates{};
+
+    // Delegates that are only called with the latest Envelope per senderStamp.
+    class ConflatingDelegate;
+    std::mutex m_mapOfConflatingDelegatesMutex{};
+    std::unordered_map<int32_t, std::shared_ptr<ConflatingDelegate>, UseUInt32ValueAsHashKey> m_mapOfConflatingDelegates{};
+
+    // Delegates for views on payloads in shared memory pools; they are not replaced while m_delegateMutex is held.
+    std::mutex m_mapOfZeroCopyDelegatesMutex{};
+    std::unordered_map<int32_t,
+                       std::function<void(const cluon::data::Envelope &envelope, const char *data, uint32_t size)>,
+                       UseUInt32ValueAsHashKey>
+        m_mapOfZeroCopyDelegates{};
 };
 
 } // namespace cluon
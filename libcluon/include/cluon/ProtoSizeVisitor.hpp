@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_PROTOSIZEVISITOR_HPP
+#define CLUON_PROTOSIZEVISITOR_HPP
+
+#include "cluon/ProtoConstants.hpp"
+#include "cluon/cluon.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace cluon {
+/**
+This class computes the number of bytes that cluon::ToProtoVisitor produces
+when encoding a given message in Proto format without encoding it:
+
+\code{.cpp}
+MyMessage msg;
+// Set some values in msg.
+
+cluon::ProtoSizeVisitor protoSize;
+msg.accept(protoSize);
+std::cout << "Encoded size: " << protoSize.size() << std::endl;
+\endcode
+*/
+class LIBCLUON_API ProtoSizeVisitor {
+   private:
+    ProtoSizeVisitor(const ProtoSizeVisitor &) = delete;
+    ProtoSizeVisitor(ProtoSizeVisitor &&)      = delete;
+    ProtoSizeVisitor &operator=(const ProtoSizeVisitor &) = delete;
+    ProtoSizeVisitor &operator=(ProtoSizeVisitor &&) = delete;
+
+   public:
+    ProtoSizeVisitor()  = default;
+    ~ProtoSizeVisitor() = default;
+
+    /**
+     * @return Size of the encoded data in Proto format in bytes.
+     */
+    std::size_t size() const noexcept;
+
+    /**
+     * This method computes the number of bytes to encode a given value in VarInt.
+     *
+     * @param v Value to encode.
+     * @return Bytes needed.
+     */
+    static std::size_t varIntSize(uint64_t v) noexcept;
+
+   public:
+    // The following methods are provided to allow an instance of this class to
+    // be used as visitor for an instance with the method signature void accept<T>(T&);
+
+    void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept;
+    void postVisit() noexcept;
+
+    void visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept;
+
+    template <typename T>
+    void visit(uint32_t &id, const char *typeName, const char *name, T &value) noexcept {
+        (void)typeName;
+        (void)name;
+
+        cluon::ProtoSizeVisitor nestedProtoSize;
+        value.accept(nestedProtoSize);
+        m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::LENGTH_DELIMITED)) + varIntSize(nestedProtoSize.size()) + nestedProtoSize.size();
+    }
+
+    // Former visitor protocol passing type and field names as std::string.
+    template <typename T>
+    void visit(uint32_t id, std::string &&typeName, std::string &&name, T &value) noexcept {
+        visit(id, typeName.c_str(), name.c_str(), value);
+    }
+
+   private:
+    std::size_t keySize(uint32_t fieldIdentifier, uint8_t protoType) noexcept;
+
+   private:
+    std::size_t m_size{0};
+};
+} // namespace cluon
+
+#endif
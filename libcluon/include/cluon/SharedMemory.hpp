@@ -24,11 +24,68 @@
 #include <cstddef>
 #include <cstdint>
 #include <atomic>
+#include <chrono>
+#include <functional>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace cluon {
+/**
+This class provides a named shared memory area with a process-shared lock
+and condition to exchange data between processes on the same host.
 
+Besides locking the shared memory area with lock()/unlock(), readers can
+access the data without blocking the writer by using a sequence counter
+(seqlock) in the shared memory header: The writer encloses the modification
+of the data with beginWrite()/endWrite() and readers copy the data
+optimistically; if the data was modified while being read, the read is
+repeated:
+
+\code{.cpp}
+// Writer:
+cluon::SharedMemory sm{"/camera", 1024};
+sm.lock();
+sm.beginWrite();
+std::memcpy(sm.data(), frame, 1024);
+sm.endWrite();
+sm.unlock();
+sm.notifyAll();
+
+// Reader:
+cluon::SharedMemory sm{"/camera"};
+std::string copy;
+sm.wait();
+bool consistent = sm.read([&copy](const char *data, uint32_t size) { copy.assign(data, size); });
+\endcode
+
+On Linux, the shared memory area can be created with Options::futex to let
+notifyAll() wake waiting threads with a futex on a counter in the shared
+memory header; hence, neither the notifying nor the waiting threads need
+to acquire the process-shared lock. Attaching processes use the mechanism
+chosen by the creator.
+
+Alternatively, the shared memory area can be created with a number of equally
+sized slots (for instance, for triple buffering of camera frames): The producer
+always writes the next slot without waiting for consumers and every consumer
+either picks the newest slot or the next slot it has not read yet:
+
+\code{.cpp}
+// Producer:
+cluon::SharedMemory sm{"/camera", 1024, 3};
+char *slot = sm.beginWriteSlot();
+std::memcpy(slot, frame, 1024);
+sm.endWriteSlot(1024, cluon::time::now());
+sm.notifyAll();
+
+// Consumer:
+cluon::SharedMemory sm{"/camera"};
+sm.wait();
+sm.readSlot([](const char *data, uint32_t size, const cluon::data::TimeStamp &sampleTimeStamp) {
+    // Copy or process data.
+}, cluon::SharedMemory::SlotSelection::NEWEST);
+\endcode
+*/
 class LIBCLUON_API SharedMemory {
    private:
     SharedMemory(const SharedMemory &) = delete;
@@ -37,6 +94,46 @@ class LIBCLUON_API SharedMemory {
     SharedMemory &operator=(SharedMemory &&) = delete;
 
    public:
+    /**
+     * Selection of the slot to read from a shared memory area with slots.
+     */
+    enum class SlotSelection : uint8_t {
+        NEWEST = 0, // Newest written slot; older unread slots are skipped.
+        NEXT   = 1, // Oldest slot that was not read yet and is not overwritten.
+    };
+
+    /**
+     * Options to create or to attach to a shared memory area; all options
+     * fall back to the default behavior when not available.
+     *
+     * Pages are only locked into RAM when lock is set.
+     */
+    struct Options {
+        bool hugePages{false};  // Use huge pages (SysV: SHM_HUGETLB when creating; otherwise: transparent huge pages).
+        bool populate{false};   // Prefault all pages (MAP_POPULATE).
+        bool lock{false};       // Lock all pages into RAM (mlock).
+        uint32_t alignment{64}; // Alignment of data() in bytes when creating; power of two up to 4096.
+        bool futex{false};      // Linux: Use a futex instead of the condition for wait()/notifyAll() when creating.
+    };
+
+    /**
+     * Progress of a reader registered with registerReader(). Frames are the
+     * published slots or, without slots, the calls to setTimeStamp().
+     */
+    struct ReaderStatus {
+        uint32_t processID{0};              // Process identifier of the reader.
+        uint64_t cursor{0};                 // Number of frames the reader has consumed (read or skipped).
+        uint64_t lag{0};                    // Number of published frames the reader has not consumed yet.
+        uint64_t missedFrames{0};           // Number of frames the reader has skipped.
+        cluon::data::TimeStamp heartbeat{}; // Time of the reader's last read or call to heartbeat().
+    };
+
+    // Number of readers that can be registered with one shared memory area.
+    static constexpr uint32_t MAX_NUMBER_OF_READERS{16};
+
+    // Time in microseconds without heartbeat after which the entry of a terminated reader is reused.
+    static constexpr int64_t READER_TIMEOUT{2 * 1000 * 1000};
+
     /**
      * Constructor.
      *
@@ -44,8 +141,19 @@ class LIBCLUON_API SharedMemory {
      * be longer than NAME_MAX (255) on POSIX or PATH_MAX on WIN32. If the name
      * is missing a leading '/' or is longer than 255, it will be adjusted accordingly.
      * @param size of the shared memory area to create; if size is 0, the class tries to attach to an existing area.
+     * @param numberOfSlots If greater than 0, the shared memory area is created with this number of slots of the given size each.
+     */
+    SharedMemory(const std::string &name, uint32_t size = 0, uint32_t numberOfSlots = 0) noexcept;
+
+    /**
+     * Constructor.
+     *
+     * @param name Name of the shared memory area (cf. above).
+     * @param size of the shared memory area to create; if size is 0, the class tries to attach to an existing area.
+     * @param numberOfSlots If greater than 0, the shared memory area is created with this number of slots of the given size each.
+     * @param options Options for creating or attaching to the shared memory area.
      */
-    SharedMemory(const std::string &name, uint32_t size = 0) noexcept;
+    SharedMemory(const std::string &name, uint32_t size, uint32_t numberOfSlots, const Options &options) noexcept;
     ~SharedMemory() noexcept;
 
     /**
@@ -68,6 +176,24 @@ class LIBCLUON_API SharedMemory {
      */
     void wait() noexcept;
 
+    /**
+     * This method waits for being notified from the shared condition for at
+     * most the given duration.
+     *
+     * @param timeout Maximum duration to wait.
+     * @return true if notifyAll() was called while waiting; false on timeout.
+     */
+    bool waitFor(const std::chrono::microseconds &timeout) noexcept;
+
+    /**
+     * This method waits for being notified from the shared condition until
+     * the given point in time.
+     *
+     * @param deadline Point in time to stop waiting.
+     * @return true if notifyAll() was called while waiting; false on timeout.
+     */
+    bool waitUntil(const std::chrono::steady_clock::time_point &deadline) noexcept;
+
     /**
      * This method notifies all threads waiting on the shared condition.
      */
@@ -76,7 +202,10 @@ class LIBCLUON_API SharedMemory {
     /**
      * This method sets the time stamp that can be used to
      * express the sample time stamp of the data in residing
-     * in the shared memory.
+     * in the shared memory and increments the frame counter.
+     * Both are stored in the shared memory header; when called
+     * between beginWrite() and endWrite(), they are consistent
+     * with the data for lock-free readers.
      *
      * This method is only allowed when the shared memory is locked.
      *
@@ -94,6 +223,130 @@ class LIBCLUON_API SharedMemory {
      */
     std::pair<bool, cluon::data::TimeStamp> getTimeStamp() noexcept;
 
+    /**
+     * This method returns the sample time stamp without locking the shared
+     * memory; it is consistent with the data when called from the delegate
+     * passed to read().
+     *
+     * @return Sample time stamp set by the last call to setTimeStamp().
+     */
+    cluon::data::TimeStamp sampleTimeStamp() const noexcept;
+
+    /**
+     * @return Number of calls to setTimeStamp() to detect new and missed frames without locking.
+     */
+    uint64_t frameCounter() const noexcept;
+
+    /**
+     * This method marks the beginning of a modification of the shared memory
+     * area for lock-free readers (cf. read): The sequence counter in the shared
+     * memory header is odd until endWrite() is called. Several writers and
+     * readers that use lock() must still be excluded by calling this method
+     * while the shared memory is locked.
+     */
+    void beginWrite() noexcept;
+
+    /**
+     * This method marks the end of a modification of the shared memory area
+     * that was started with beginWrite().
+     */
+    void endWrite() noexcept;
+
+    /**
+     * This method reads the shared memory area without locking it: The
+     * delegate is called with the data and is called again whenever a writer
+     * modified the data in the meantime. Thus, the delegate must only copy or
+     * process the data without relying on its consistency; the result of the
+     * last call is consistent when this method returns true.
+     *
+     * @param delegate Function to copy or process the data.
+     * @param maxNumberOfRetries Maximum number of times to repeat a torn read.
+     * @return true if the delegate has seen consistent data; false if the shared memory is invalid or a writer did not finish in time.
+     */
+    bool read(std::function<void(const char *data, uint32_t size)> delegate, uint32_t maxNumberOfRetries = 1000) noexcept;
+
+    /**
+     * @return Sequence counter of the data that is incremented by beginWrite() and endWrite() (i.e., odd while the data is modified).
+     */
+    uint32_t sequence() const noexcept;
+
+    /**
+     * This method returns the next slot to write without waiting for any
+     * consumer; the slot is published with endWriteSlot(). Several producers
+     * must be excluded by calling this method while the shared memory is locked.
+     *
+     * @return Pointer to the slot of slotSize() bytes or nullptr if the shared memory area has no slots.
+     */
+    char *beginWriteSlot() noexcept;
+
+    /**
+     * This method publishes the slot returned by beginWriteSlot().
+     *
+     * @param length Number of bytes written to the slot.
+     * @param sampleTimeStamp Sample time stamp of the data in the slot.
+     */
+    void endWriteSlot(uint32_t length, const cluon::data::TimeStamp &sampleTimeStamp) noexcept;
+
+    /**
+     * This method reads a slot without locking the shared memory area. As with
+     * read(), the delegate is called again when the slot was overwritten
+     * while being read.
+     *
+     * @param delegate Function to copy or process the data of the slot.
+     * @param selection Slot to read.
+     * @return true if the delegate has seen consistent data; false if there is no unread slot.
+     */
+    bool readSlot(std::function<void(const char *data, uint32_t size, const cluon::data::TimeStamp &sampleTimeStamp)> delegate,
+                  SlotSelection selection = SlotSelection::NEXT) noexcept;
+
+    /**
+     * @return Number of slots in the shared memory area or 0 if it has no slots.
+     */
+    uint32_t numberOfSlots() const noexcept;
+
+    /**
+     * @return Size of one slot or 0 if the shared memory area has no slots.
+     */
+    uint32_t slotSize() const noexcept;
+
+    /**
+     * This method registers this instance as reader in the shared memory
+     * header so that the producer can inspect its progress with readers().
+     * The reader's cursor, missed frames, and heartbeat are updated by read()
+     * and readSlot(); the registration ends when this instance is destroyed.
+     *
+     * Entries of readers that crashed are reused once their heartbeat is
+     * older than READER_TIMEOUT and their process has terminated, or once
+     * their heartbeat is older than 10 * READER_TIMEOUT. The latter covers
+     * reused process identifiers and readers in other PID namespaces, which
+     * cannot be checked for termination. Thus, registered readers that do not
+     * read regularly should call heartbeat() more often than READER_TIMEOUT.
+     * A reader whose entry was reused is unregistered on its next read.
+     *
+     * @return true if this instance is registered; false if all MAX_NUMBER_OF_READERS entries are in use.
+     */
+    bool registerReader() noexcept;
+
+    /**
+     * This method removes the registration from registerReader().
+     */
+    void unregisterReader() noexcept;
+
+    /**
+     * This method updates the heartbeat of this registered reader without reading.
+     */
+    void heartbeat() noexcept;
+
+    /**
+     * @return Number of frames this registered reader has skipped.
+     */
+    uint64_t missedFrames() const noexcept;
+
+    /**
+     * @return Progress of all registered readers.
+     */
+    std::vector<ReaderStatus> readers() const noexcept;
+
    public:
     /**
      * @return True if the shared memory area is existing and usable.
@@ -115,6 +368,16 @@ class LIBCLUON_API SharedMemory {
      */
     const std::string name() const noexcept;
 
+    /**
+     * This method sets whether this instance removes the shared memory area
+     * when it is destroyed. By default, only the instance that created the
+     * shared memory area removes it; processes that are still attached keep
+     * using it until they detach, but it cannot be attached to anymore.
+     *
+     * @param remove True to remove the shared memory area on destruction.
+     */
+    void removeOnDestruction(bool remove) noexcept;
+
 #ifdef WIN32
    private:
     void initWIN32() noexcept;
@@ -122,32 +385,82 @@ class LIBCLUON_API SharedMemory {
     void lockWIN32() noexcept;
     void unlockWIN32() noexcept;
     void waitWIN32() noexcept;
+    void waitUntilWIN32(uint32_t generation, const std::chrono::steady_clock::time_point &deadline) noexcept;
     void notifyAllWIN32() noexcept;
 #else
    private:
     void initPOSIX() noexcept;
     void deinitPOSIX() noexcept;
     void lockPOSIX() noexcept;
+    void recoverPOSIX() noexcept;
     void unlockPOSIX() noexcept;
     void waitPOSIX() noexcept;
+    void waitUntilPOSIX(uint32_t generation, const std::chrono::steady_clock::time_point &deadline) noexcept;
     void notifyAllPOSIX() noexcept;
     bool validPOSIX() noexcept;
+    void applyOptions(bool prefault) noexcept;
 
     void initSysV() noexcept;
     void deinitSysV() noexcept;
     void lockSysV() noexcept;
     void unlockSysV() noexcept;
     void waitSysV() noexcept;
+    void waitUntilSysV(uint32_t generation, const std::chrono::steady_clock::time_point &deadline) noexcept;
     void notifyAllSysV() noexcept;
     bool validSysV() noexcept;
+
+    void waitUntilFutex(uint32_t generation, const std::chrono::steady_clock::time_point &deadline) noexcept;
+    void notifyAllFutex() noexcept;
 #endif
 
+   private:
+    // Entry of a registered reader in the shared memory header.
+    struct ReaderControl {
+        std::atomic<uint32_t> __processID; // 0 if the entry is unused.
+        std::atomic<uint64_t> __cursor;
+        std::atomic<uint64_t> __missedFrames;
+        std::atomic<int64_t> __heartbeat; // Microseconds since the epoch.
+    };
+
+    // Header fields shared by all implementations that precede the user-accessible data.
+    struct SharedMemoryControl {
+        uint32_t __size;
+        uint32_t __dataOffset; // Offset of the user-accessible data from the beginning of the shared memory.
+        std::atomic<uint32_t> __sequence;
+        uint32_t __numberOfSlots;
+        uint32_t __slotSize;
+        std::atomic<uint64_t> __writeIndex; // Number of published slots.
+        std::atomic<uint32_t> __generation; // Number of calls to notifyAll().
+        std::atomic<int32_t> __seconds;     // Sample time stamp.
+        std::atomic<int32_t> __microseconds;
+        std::atomic<uint64_t> __frameCounter; // Number of calls to setTimeStamp().
+        uint32_t __useFutex;                  // Notifications use __generation as futex.
+        std::atomic<uint32_t> __futexWaiters;
+        ReaderControl __readers[MAX_NUMBER_OF_READERS];
+    };
+    struct SlotHeader;
+
+    uint32_t dataOffsetAfter(std::size_t headerSize) const noexcept;
+    void initSharedMemoryControl() noexcept;
+    SlotHeader *slot(uint64_t index) noexcept;
+    uint64_t publishedFrames() const noexcept;
+    void updateReader(uint64_t consumedFrames, uint64_t missedFrames) noexcept;
+
    private:
     std::string m_name{""};
-    std::string m_nameForTimeStamping{""};
     uint32_t m_size{0};
+    Options m_options{};
+    uint32_t m_dataOffset{0};
     char *m_sharedMemory{nullptr};
     char *m_userAccessibleSharedMemory{nullptr};
+    SharedMemoryControl *m_sharedMemoryControl{nullptr};
+    uint32_t m_numberOfSlots{0};
+    uint32_t m_slotSize{0};
+    uint32_t m_slotStride{0};
+    uint64_t m_writingSlot{0};
+    uint64_t m_readCursor{0}; // Next slot to read or, without slots, frames seen by a registered reader.
+    int32_t m_readerIndex{-1};
+    uint32_t m_readerProcessID{0};
     bool m_hasOnlyAttachedToSharedMemory{false};
 
     std::atomic<bool> m_broken{false};
@@ -158,17 +471,16 @@ class LIBCLUON_API SharedMemory {
     HANDLE __mutex{nullptr};
     HANDLE __sharedMemory{nullptr};
 #else
-    int32_t m_fdForTimeStamping{-1};
-
     bool m_usePOSIX{true};
+    bool m_useFutex{false};
 
     // Member fields for POSIX-based shared memory.
 #if !defined(__NetBSD__) && !defined(__OpenBSD__)
     int32_t m_fd{-1};
     struct SharedMemoryHeader {
-        uint32_t __size;
         pthread_mutex_t __mutex;
         pthread_cond_t __condition;
+        SharedMemoryControl __control;
     };
     SharedMemoryHeader *m_sharedMemoryHeader{nullptr};
 #endif
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_SHAREDMEMORYPOOL_HPP
+#define CLUON_SHAREDMEMORYPOOL_HPP
+
+#include "cluon/SharedMemory.hpp"
+#include "cluon/cluon.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace cluon {
+/**
+This class provides a pool of equally sized, reference-counted slots on top of
+cluon::SharedMemory to hand over large payloads to other processes on the same
+host without copying them: The owner of the pool stores a payload in a free
+slot and passes the returned reference (for instance, in a small Envelope) to
+other processes, which access the payload directly in the shared memory area.
+
+A slot stays in use while it is referenced: The owner holds a reference to
+every stored payload until it needs the slot for a new payload, and every
+attached instance that was registered when the payload was stored holds on to
+it until it has accessed the payload or a newer one. Thus, store() does not
+overwrite payloads for slow readers but fails once all slots are in use.
+Readers that do not refresh their heartbeat via access() or heartbeat() for
+HEARTBEAT_TIMEOUT, for instance because they crashed, are dropped by the owner
+and release their payloads. A reference becomes stale once the owner has
+reused its slot, which is detected by access().
+
+Attached instances consider the pool valid only while the owner refreshes its
+heartbeat via store() or heartbeat(); the owner stops doing so when it is
+destroyed.
+
+\code{.cpp}
+// Owner:
+cluon::SharedMemoryPool pool{"/myPool", 4, 8 * 1024 * 1024};
+uint64_t reference = pool.store(frame);
+
+// Other process:
+cluon::SharedMemoryPool pool{"/myPool"};
+pool.access(reference, [](const char *data, uint32_t length) {
+    // Process data without copying.
+});
+\endcode
+*/
+class LIBCLUON_API SharedMemoryPool {
+   private:
+    SharedMemoryPool(const SharedMemoryPool &) = delete;
+    SharedMemoryPool(SharedMemoryPool &&)      = delete;
+    SharedMemoryPool &operator=(const SharedMemoryPool &) = delete;
+    SharedMemoryPool &operator=(SharedMemoryPool &&) = delete;
+
+   public:
+    // Time in microseconds without heartbeat after which the owner or a reader is considered dead.
+    static constexpr int64_t HEARTBEAT_TIMEOUT{2 * 1000 * 1000};
+
+   public:
+    /**
+     * Constructor to create a new pool owned by this instance.
+     *
+     * @param name Name of the shared memory area holding the pool.
+     * @param numberOfSlots Number of slots.
+     * @param slotSize Maximum size of one payload in bytes.
+     */
+    SharedMemoryPool(const std::string &name, uint32_t numberOfSlots, uint32_t slotSize) noexcept;
+
+    /**
+     * Constructor to attach to an existing pool; the instance registers as
+     * reader unless MAX_READERS (64) instances are attached already.
+     *
+     * @param name Name of the shared memory area holding the pool.
+     */
+    explicit SharedMemoryPool(const std::string &name) noexcept;
+    ~SharedMemoryPool() noexcept;
+
+    /**
+     * @return true if the pool is usable; for attached instances, the owner also needs to be alive.
+     */
+    bool valid() noexcept;
+
+    /**
+     * @return Number of slots in the pool.
+     */
+    uint32_t numberOfSlots() const noexcept;
+
+    /**
+     * @return Maximum size in bytes for one payload.
+     */
+    uint32_t slotSize() const noexcept;
+
+    /**
+     * This method stores the given payload in a free slot; if no slot is free,
+     * the slot of the oldest stored payload is reused unless it is accessed or
+     * still pending for a registered reader. Only the owner of the pool can
+     * store payloads.
+     *
+     * @param data Payload to store.
+     * @return Reference to the stored payload or 0 if it could not be stored.
+     */
+    uint64_t store(const std::string &data) noexcept;
+
+    /**
+     * This method calls the given delegate with the referenced payload in the
+     * shared memory area; the payload is not reused while the delegate runs.
+     *
+     * @param reference Reference returned by store().
+     * @param delegate Function to process the payload; the pointer is only valid while the delegate runs.
+     * @return true if the delegate was called; false if the reference is stale.
+     */
+    bool access(uint64_t reference, std::function<void(const char *data, uint32_t length)> delegate) noexcept;
+
+    /**
+     * This method refreshes the heartbeat of this instance; the owner and
+     * readers that do not call store() or access() regularly need to call it
+     * more often than HEARTBEAT_TIMEOUT.
+     */
+    void heartbeat() noexcept;
+
+   private:
+    struct Reader;
+    struct PoolHeader;
+    struct SlotHeader;
+    SlotHeader *slot(uint32_t index) noexcept;
+    bool tryToAcquire(uint32_t index) noexcept;
+    void registerReader() noexcept;
+    void reclaimReaders() noexcept;
+    void releasePending(uint32_t readerIndex) noexcept;
+    uint64_t pendingReaders() noexcept;
+
+   private:
+    std::unique_ptr<cluon::SharedMemory> m_sharedMemory{nullptr};
+    PoolHeader *m_header{nullptr};
+    char *m_slots{nullptr};
+    uint32_t m_numberOfSlots{0};
+    uint32_t m_slotSize{0};
+    bool m_isOwner{false};
+    int32_t m_readerIndex{-1};
+    uint64_t m_readerOwner{0};
+
+    // Slots holding stored payloads of the owner in the order they were stored.
+    std::deque<uint32_t> m_storedSlots{};
+};
+} // namespace cluon
+
+#endif
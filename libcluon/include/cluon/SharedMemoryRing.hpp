@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_SHAREDMEMORYRING_HPP
+#define CLUON_SHAREDMEMORYRING_HPP
+
+#include "cluon/SharedMemory.hpp"
+#include "cluon/cluon.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace cluon {
+/**
+This class provides a multi-producer broadcast ring on top of cluon::SharedMemory
+to exchange byte sequences (for instance, serialized Envelopes) between processes
+on the same host. The ring consists of a fixed number of equally sized slots;
+every instance of this class attached to the same ring is a subscriber with its
+own read cursor. Producers never wait for subscribers: A subscriber that falls
+behind by more than the number of slots misses the overwritten entries, which
+are counted in missed().
+
+On Linux, waiting subscribers are woken up using a futex in the ring's header;
+on other platforms, subscribers are polling.
+
+The ring does not belong to the process that created it: It is removed when
+the last attached instance is destroyed. A process attaching while the ring is
+being removed waits for the removal and creates a new ring. Instances of
+processes that crashed keep the ring alive, which is then reused by processes
+attaching later.
+
+\code{.cpp}
+cluon::SharedMemoryRing producer{"/myRing", 16, 64 * 1024};
+producer.push("Hello World");
+
+cluon::SharedMemoryRing subscriber{"/myRing", 16, 64 * 1024};
+std::string data;
+if (subscriber.pop(data, std::chrono::milliseconds(100))) {
+    // Process data.
+}
+\endcode
+*/
+class LIBCLUON_API SharedMemoryRing {
+   private:
+    SharedMemoryRing(const SharedMemoryRing &) = delete;
+    SharedMemoryRing(SharedMemoryRing &&)      = delete;
+    SharedMemoryRing &operator=(const SharedMemoryRing &) = delete;
+    SharedMemoryRing &operator=(SharedMemoryRing &&) = delete;
+
+   public:
+    /**
+     * Constructor to attach to an existing ring with the given name or to
+     * create a new one if no ring with this name exists. When attaching to an
+     * existing ring, its layout (number and size of slots) is used.
+     *
+     * @param name Name of the shared memory area holding the ring.
+     * @param numberOfSlots Number of slots when creating the ring.
+     * @param slotSize Maximum size of one entry in bytes when creating the ring.
+     */
+    SharedMemoryRing(const std::string &name, uint32_t numberOfSlots, uint32_t slotSize) noexcept;
+    ~SharedMemoryRing() noexcept;
+
+    /**
+     * @return true if the ring is usable.
+     */
+    bool valid() noexcept;
+
+    /**
+     * @return Number of slots in the ring.
+     */
+    uint32_t numberOfSlots() const noexcept;
+
+    /**
+     * @return Maximum size in bytes for one entry.
+     */
+    uint32_t slotSize() const noexcept;
+
+    /**
+     * This method appends the given data to the ring and wakes up all waiting
+     * subscribers.
+     *
+     * @param data Data to append.
+     * @return true if the data was appended; false if the data does not fit into a slot.
+     */
+    bool push(const std::string &data) noexcept;
+
+    /**
+     * This method returns the next unread entry for this subscriber.
+     *
+     * @param data String to receive the next entry.
+     * @param timeout Maximum time to wait for a new entry.
+     * @return true if an entry was read; false on timeout.
+     */
+    bool pop(std::string &data, std::chrono::microseconds timeout) noexcept;
+
+    /**
+     * @return Process identifier of the producer of the entry returned by the last successful call to pop.
+     */
+    int32_t producer() const noexcept;
+
+    /**
+     * @return Number of entries this subscriber has missed as they were overwritten before being read.
+     */
+    uint64_t missed() const noexcept;
+
+    /**
+     * This method registers a participant identifier (for instance, the
+     * local UDP port used to send the same data via the network) for this
+     * process in the ring. Participants are kept alive by the heartbeat of
+     * their process, which is refreshed by pop() and heartbeat(); entries of
+     * participants without heartbeat for two seconds are reused.
+     *
+     * @param id Participant identifier (> 0).
+     * @return true if the participant could be registered.
+     */
+    bool addParticipant(uint16_t id) noexcept;
+
+    /**
+     * This method removes the registration of the given participant
+     * identifier for this process.
+     *
+     * @param id Participant identifier.
+     */
+    void removeParticipant(uint16_t id) noexcept;
+
+    /**
+     * This method checks whether the given participant identifier is
+     * registered by any live process; entries of dead participants are removed.
+     *
+     * @param id Participant identifier.
+     * @return true if the given participant identifier is registered in this ring.
+     */
+    bool isParticipant(uint16_t id) noexcept;
+
+    /**
+     * This method refreshes the heartbeat of all participants of this process.
+     */
+    void heartbeat() noexcept;
+
+   private:
+    bool attach(const std::string &name, uint32_t numberOfSlots, uint32_t slotSize, bool replaceClosedRing) noexcept;
+    void wakeUp() noexcept;
+    void waitForNewEntries(uint32_t generation, std::chrono::microseconds timeout) noexcept;
+
+   private:
+    std::unique_ptr<cluon::SharedMemory> m_sharedMemory{nullptr};
+    struct Participant;
+    struct RingHeader;
+    struct SlotHeader;
+    RingHeader *m_header{nullptr};
+    char *m_slots{nullptr};
+    uint32_t m_numberOfSlots{0};
+    uint32_t m_slotSize{0};
+
+    uint64_t m_cursor{0};
+    uint64_t m_missed{0};
+    int32_t m_producer{0};
+
+    bool m_stalled{false};
+    std::chrono::steady_clock::time_point m_stalledSince{};
+    std::chrono::steady_clock::time_point m_lastHeartbeat{};
+};
+} // namespace cluon
+
+#endif
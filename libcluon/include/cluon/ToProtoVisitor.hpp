@@ -10,15 +10,29 @@
 #define CLUON_TOPROTOVISITOR_HPP
 
 #include "cluon/ProtoConstants.hpp"
+#include "cluon/ProtoSizeVisitor.hpp"
 #include "cluon/cluon.hpp"
 
+#include <cstddef>
 #include <cstdint>
-#include <sstream>
 #include <string>
 
 namespace cluon {
 /**
 This class encodes a given message in Proto format.
+
+The encoded data is written into one contiguous, growable buffer. To avoid
+repeated allocations when encoding many messages, an instance can be reused
+after reset(), which keeps the allocated capacity, or it can encode directly
+into a caller-supplied std::string:
+
+\code{.cpp}
+std::string buffer;
+buffer.reserve(1024);
+cluon::ToProtoVisitor protoEncoder{buffer};
+msg.accept(protoEncoder); // buffer holds the encoded msg.
+protoEncoder.reset();     // buffer is empty but keeps its capacity.
+\endcode
 */
 class LIBCLUON_API ToProtoVisitor {
    private:
@@ -28,7 +42,15 @@ class LIBCLUON_API ToProtoVisitor {
     ToProtoVisitor &operator=(ToProtoVisitor &&) = delete;
 
    public:
-    ToProtoVisitor()  = default;
+    ToProtoVisitor() noexcept;
+
+    /**
+     * Constructor to encode into a caller-supplied buffer; the encoded data
+     * is appended to the existing content of the given buffer.
+     *
+     * @param buffer Buffer to encode into; it must outlive this instance.
+     */
+    explicit ToProtoVisitor(std::string &buffer) noexcept;
     ~ToProtoVisitor() = default;
 
     /**
@@ -36,6 +58,29 @@ class LIBCLUON_API ToProtoVisitor {
      */
     std::string encodedData() const noexcept;
 
+    /**
+     * @return Pointer to the encoded data; valid until the next modification.
+     */
+    const char *data() const noexcept;
+
+    /**
+     * @return Size of the encoded data in bytes.
+     */
+    std::size_t size() const noexcept;
+
+    /**
+     * This method reserves capacity for encoded data to avoid reallocations.
+     *
+     * @param capacity Number of bytes to reserve for encoded data.
+     */
+    void reserve(std::size_t capacity) noexcept;
+
+    /**
+     * This method discards the encoded data so that this instance can be
+     * reused; the allocated memory is kept.
+     */
+    void reset() noexcept;
+
    public:
     // The following methods are provided to allow an instance of this class to
     // be used as visitor for an instance with the method signature void accept<T>(T&);
@@ -43,44 +88,52 @@ class LIBCLUON_API ToProtoVisitor {
     void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept;
     void postVisit() noexcept;
 
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept;
 
     template <typename T>
-    void visit(uint32_t &id, std::string &&typeName, std::string &&name, T &value) noexcept {
+    void visit(uint32_t &id, const char *typeName, const char *name, T &value) noexcept {
         (void)typeName;
         (void)name;
 
-        toVarInt(m_buffer, std::move(encodeKey(id, static_cast<uint8_t>(ProtoConstants::LENGTH_DELIMITED))));
-        cluon::ToProtoVisitor nestedProtoEncoder;
-        value.accept(nestedProtoEncoder);
-        encode(m_buffer, std::move(nestedProtoEncoder.encodedData()));
+        toVarInt(*m_buffer, encodeKey(id, static_cast<uint8_t>(ProtoConstants::LENGTH_DELIMITED)));
+        // Compute the length prefix first to encode the nested message straight into this buffer.
+        cluon::ProtoSizeVisitor nestedProtoSize;
+        value.accept(nestedProtoSize);
+        toVarInt(*m_buffer, nestedProtoSize.size());
+        value.accept(*this);
+    }
+
+    // Former visitor protocol passing type and field names as std::string.
+    template <typename T>
+    void visit(uint32_t id, std::string &&typeName, std::string &&name, T &value) noexcept {
+        visit(id, typeName.c_str(), name.c_str(), value);
     }
 
    private:
-    std::size_t encode(std::ostream &o, bool &v) noexcept;
-    std::size_t encode(std::ostream &o, int8_t &v) noexcept;
-    std::size_t encode(std::ostream &o, uint8_t &v) noexcept;
-    std::size_t encode(std::ostream &o, int16_t &v) noexcept;
-    std::size_t encode(std::ostream &o, uint16_t &v) noexcept;
-    std::size_t encode(std::ostream &o, int32_t &v) noexcept;
-    std::size_t encode(std::ostream &o, uint32_t &v) noexcept;
-    std::size_t encode(std::ostream &o, int64_t &v) noexcept;
-    std::size_t encode(std::ostream &o, uint64_t &v) noexcept;
-    std::size_t encode(std::ostream &o, float &v) noexcept;
-    std::size_t encode(std::ostream &o, double &v) noexcept;
-    std::size_t encode(std::ostream &o, const std::string &v) noexcept;
+    std::size_t encode(std::string &o, bool &v) noexcept;
+    std::size_t encode(std::string &o, int8_t &v) noexcept;
+    std::size_t encode(std::string &o, uint8_t &v) noexcept;
+    std::size_t encode(std::string &o, int16_t &v) noexcept;
+    std::size_t encode(std::string &o, uint16_t &v) noexcept;
+    std::size_t encode(std::string &o, int32_t &v) noexcept;
+    std::size_t encode(std::string &o, uint32_t &v) noexcept;
+    std::size_t encode(std::string &o, int64_t &v) noexcept;
+    std::size_t encode(std::string &o, uint64_t &v) noexcept;
+    std::size_t encode(std::string &o, float &v) noexcept;
+    std::size_t encode(std::string &o, double &v) noexcept;
+    std::size_t encode(std::string &o, const std::string &v) noexcept;
 
    private:
     uint8_t toZigZag8(int8_t v) noexcept;
@@ -91,11 +144,11 @@ class LIBCLUON_API ToProtoVisitor {
     /**
      * This method encodes a given value in VarInt.
      *
-     * @param out std::ostream to encode to.
+     * @param out Buffer to append the encoded value to.
      * @param v Value to encode.
      * @return Bytes written.
      */
-    std::size_t toVarInt(std::ostream &out, uint64_t v) noexcept;
+    std::size_t toVarInt(std::string &out, uint64_t v) noexcept;
 
     /**
      * This method creates a key/value pair encoded in Proto format.
@@ -108,8 +161,8 @@ class LIBCLUON_API ToProtoVisitor {
     std::size_t toKeyValue(uint32_t fieldIdentifier, T &v) noexcept {
         std::size_t size{0};
         uint64_t key = encodeKey(fieldIdentifier, static_cast<uint8_t>(ProtoConstants::VARINT));
-        size += toVarInt(m_buffer, key);
-        size += encode(m_buffer, v);
+        size += toVarInt(*m_buffer, key);
+        size += encode(*m_buffer, v);
         return size;
     }
 
@@ -123,7 +176,10 @@ class LIBCLUON_API ToProtoVisitor {
     uint64_t encodeKey(uint32_t fieldIdentifier, uint8_t protoType) noexcept;
 
    private:
-    std::stringstream m_buffer{""};
+    std::string m_ownBuffer{};
+    std::string *m_buffer{nullptr};
+    // Encoded data starts at this offset in *m_buffer.
+    std::size_t m_offset{0};
 };
 } // namespace cluon
 
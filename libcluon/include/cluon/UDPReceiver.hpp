@@ -32,6 +32,7 @@
 #include <set>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace cluon {
 /**
@@ -78,6 +79,18 @@ class LIBCLUON_API UDPReceiver {
     UDPReceiver &operator=(const UDPReceiver &) = delete;
     UDPReceiver &operator=(UDPReceiver &&) = delete;
 
+   public:
+    /**
+     * One instruction of a classic Berkeley Packet Filter (BPF) program;
+     * its layout matches struct sock_filter on Linux.
+     */
+    struct FilterInstruction {
+        uint16_t code;
+        uint8_t jt;
+        uint8_t jf;
+        uint32_t k;
+    };
+
    public:
     /**
      * Constructor.
@@ -98,6 +111,18 @@ class LIBCLUON_API UDPReceiver {
      */
     bool isRunning() const noexcept;
 
+    /**
+     * This method attaches a classic BPF program to the socket (Linux only)
+     * so that the kernel drops all datagrams that are not accepted by the
+     * program before they are copied to user space. The program sees each
+     * datagram starting with its UDP header. A previously attached program
+     * is replaced atomically.
+     *
+     * @param program BPF program to attach; an empty program detaches a previously attached one.
+     * @return true if the program could be attached or detached.
+     */
+    bool setSocketFilter(const std::vector<FilterInstruction> &program) noexcept;
+
    private:
     /**
      * This method closes the socket.
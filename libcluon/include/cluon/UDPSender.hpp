@@ -78,16 +78,44 @@ class LIBCLUON_API UDPSender {
      */
     std::pair<ssize_t, int32_t> send(std::string &&data) const noexcept;
 
+    /**
+     * Send a given string with the given Differentiated Services Code Point
+     * (DSCP) in the IPv4 header. For a DSCP > 0, the socket priority is
+     * raised on Linux as well so that the datagram bypasses bulk data in
+     * the local queueing disciplines.
+     *
+     * @param data Data to send.
+     * @param dscp DSCP [0 .. 63] to mark the datagram with (0 = best effort, 46 = expedited forwarding).
+     * @return Pair: Number of bytes sent and errno.
+     */
+    std::pair<ssize_t, int32_t> send(std::string &&data, uint8_t dscp) const noexcept;
+
+    /**
+     * Send a given string to another address than the one given to the
+     * constructor; the datagram is sent from the same port as all others.
+     *
+     * @param data Data to send.
+     * @param sendToAddress Numerical IPv4 address to send the UDP packet to.
+     * @param sendToPort Port to send the UDP packet to.
+     * @param dscp DSCP [0 .. 63] to mark the datagram with.
+     * @return Pair: Number of bytes sent and errno.
+     */
+    std::pair<ssize_t, int32_t> sendTo(std::string &&data, const std::string &sendToAddress, uint16_t sendToPort, uint8_t dscp = 0) const noexcept;
+
    public:
     /**
      * @return Port that this UDP sender will use for sending or 0 if no information available.
      */
     uint16_t getSendFromPort() const noexcept;
 
+   private:
+    std::pair<ssize_t, int32_t> sendTo(std::string &&data, const struct sockaddr_in &sendToAddress, uint8_t dscp) const noexcept;
+
    private:
     mutable std::mutex m_socketMutex{};
     int32_t m_socket{-1};
     uint16_t m_portToSentFrom{0};
+    mutable uint8_t m_dscp{0};
     struct sockaddr_in m_sendToAddress {};
 };
 } // namespace cluon
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_VARINT_HPP
+#define CLUON_VARINT_HPP
+
+#include "cluon/PortableEndian.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace cluon {
+namespace varint {
+
+/**
+ * Maximum number of bytes of a VarInt for 64 bits.
+ */
+constexpr std::size_t MAX_SIZE{10};
+
+/**
+ * @param v Value to encode.
+ * @return Number of bytes to encode v as VarInt.
+ */
+inline std::size_t size(uint64_t v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    // Every byte carries 7 bits of the value.
+    return static_cast<std::size_t>((64 - __builtin_clzll(v | 1) + 6) / 7);
+#else
+    std::size_t size{1};
+    while (0x7f < v) {
+        v >>= 7;
+        size++;
+    }
+    return size;
+#endif
+}
+
+/**
+ * This method distributes the lower 56 bits of v to 7-bit groups in
+ * the 8 bytes of the returned value (inverse of compact()).
+ *
+ * @param v Value to spread.
+ * @return 7-bit groups without MSBs.
+ */
+inline uint64_t spread(uint64_t v) noexcept {
+    v = ((v << 4) & 0x0fffffff00000000ull) | (v & 0x000000000fffffffull);
+    v = ((v << 2) & 0x3fff00003fff0000ull) | (v & 0x00003fff00003fffull);
+    v = ((v << 1) & 0x7f007f007f007f00ull) | (v & 0x007f007f007f007full);
+    return v;
+}
+
+/**
+ * This method joins the 7-bit groups in the 8 bytes of v to a 56-bit value.
+ *
+ * @param v 7-bit groups without MSBs.
+ * @return Joined value.
+ */
+inline uint64_t compact(uint64_t v) noexcept {
+    v = ((v & 0x7f007f007f007f00ull) >> 1) | (v & 0x007f007f007f007full);
+    v = ((v & 0x3fff00003fff0000ull) >> 2) | (v & 0x00003fff00003fffull);
+    v = ((v & 0x0fffffff00000000ull) >> 4) | (v & 0x000000000fffffffull);
+    return v;
+}
+
+/**
+ * This method encodes a given value as VarInt. Values above 127 are spread
+ * into one 8-byte word that is written at once.
+ *
+ * @param v Value to encode.
+ * @param out Buffer with at least MAX_SIZE bytes.
+ * @return Bytes written.
+ */
+inline std::size_t encode(uint64_t v, char *out) noexcept {
+    // Keys and small values need only one byte.
+    if (v < 0x80) {
+        out[0] = static_cast<char>(v);
+        return 1;
+    }
+    const std::size_t SIZE{size(v)};
+    uint64_t word{spread(v)};
+    if (SIZE <= sizeof(uint64_t)) {
+        // Set the MSBs of all but the last byte.
+        word |= 0x8080808080808080ull & ((1ull << (8 * (SIZE - 1))) - 1);
+        word = htole64(word);
+        std::memcpy(out, &word, sizeof(uint64_t));
+    } else {
+        word = htole64(word | 0x8080808080808080ull);
+        std::memcpy(out, &word, sizeof(uint64_t));
+        const uint64_t REMAINDER{v >> 56};
+        if (9 == SIZE) {
+            out[8] = static_cast<char>(REMAINDER);
+        } else {
+            out[8] = static_cast<char>((REMAINDER & 0x7f) | 0x80);
+            out[9] = static_cast<char>(REMAINDER >> 7);
+        }
+    }
+    return SIZE;
+}
+
+/**
+ * This method decodes a VarInt from memory. If at least 8 bytes are
+ * available, the VarInt is decoded from a single 8-byte load and at most
+ * two further bytes without a loop.
+ *
+ * @param data Pointer to the VarInt.
+ * @param end End of the available data.
+ * @param value Decoded value.
+ * @return Bytes read or 0 if the VarInt exceeds the available data or MAX_SIZE.
+ */
+inline std::size_t decode(const char *data, const char *end, uint64_t &value) noexcept {
+    if (data >= end) {
+        return 0;
+    }
+    const uint64_t B0{static_cast<uint8_t>(data[0])};
+    if (B0 < 0x80) {
+        value = B0;
+        return 1;
+    }
+    const std::size_t AVAILABLE{static_cast<std::size_t>(end - data)};
+    if ((1 < AVAILABLE) && (static_cast<uint8_t>(data[1]) < 0x80)) {
+        value = (B0 & 0x7f) | (static_cast<uint64_t>(static_cast<uint8_t>(data[1])) << 7);
+        return 2;
+    }
+
+    if (sizeof(uint64_t) <= AVAILABLE) {
+        uint64_t word{0};
+        std::memcpy(&word, data, sizeof(uint64_t));
+        word = le64toh(word);
+        // The lowest cleared MSB marks the last byte of the VarInt.
+        const uint64_t STOP_BITS{~word & 0x8080808080808080ull};
+        if (0 != STOP_BITS) {
+            const uint64_t LOWEST_STOP_BIT{STOP_BITS & (~STOP_BITS + 1)};
+            // Keep the bytes up to and including the last byte and drop their MSBs.
+            value = compact(word & ((LOWEST_STOP_BIT << 1) - 1) & 0x7f7f7f7f7f7f7f7full);
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_ctzll(LOWEST_STOP_BIT) / 8) + 1;
+#else
+            std::size_t size{1};
+            for (uint64_t b{LOWEST_STOP_BIT}; b > 0x80; b >>= 8) { size++; }
+            return size;
+#endif
+        }
+        // VarInts with 9 or 10 bytes.
+        const uint64_t LOW{compact(word & 0x7f7f7f7f7f7f7f7full)};
+        if (8 < AVAILABLE) {
+            const uint64_t B8{static_cast<uint8_t>(data[8])};
+            if (B8 < 0x80) {
+                value = LOW | (B8 << 56);
+                return 9;
+            }
+            if ((9 < AVAILABLE) && (static_cast<uint8_t>(data[9]) < 0x80)) {
+                value = LOW | ((B8 & 0x7f) << 56) | (static_cast<uint64_t>(static_cast<uint8_t>(data[9])) << 63);
+                return 10;
+            }
+        }
+        return 0;
+    }
+
+    // Close to the end of the data.
+    uint64_t result{0};
+    for (std::size_t i{0}; i < AVAILABLE; i++) {
+        const uint64_t C{static_cast<uint8_t>(data[i])};
+        result |= (C & 0x7f) << (7 * i);
+        if (C < 0x80) {
+            value = result;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+} // namespace varint
+} // namespace cluon
+
+#endif
@@ -43,7 +43,7 @@ std::string EnvelopeConverter::getJSONFromProtoEncodedEnvelope(const std::string
     std::string retVal{"{}"};
     if (!m_listOfMetaMessages.empty()) {
         cluon::data::Envelope envelope;
-        std::stringstream sstr(protoEncodedEnvelope);
+        bool isOD4Container{false};
         constexpr uint8_t OD4_HEADER_SIZE{5};
         if (OD4_HEADER_SIZE < protoEncodedEnvelope.size()) {
             // Try decoding complete OD4-encoded Envelope including header.
@@ -53,7 +53,8 @@ std::string EnvelopeConverter::getJSONFromProtoEncodedEnvelope(const std::string
                 uint32_t length = (*reinterpret_cast<const uint32_t *>(protoEncodedEnvelope.data() + 1));
                 length          = le32toh(length) >> 8;
                 if ((OD4_HEADER_SIZE + length) == protoEncodedEnvelope.size()) {
-                    auto result{extractEnvelope(sstr)};
+                    isOD4Container = true;
+                    auto result{extractEnvelope(protoEncodedEnvelope.data(), protoEncodedEnvelope.size())};
                     if (result.first) {
                         envelope = result.second;
                     }
@@ -61,10 +62,10 @@ std::string EnvelopeConverter::getJSONFromProtoEncodedEnvelope(const std::string
             }
         }
 
-        if (0 == envelope.dataType()) {
+        if (!isOD4Container && (0 == envelope.dataType())) {
             // Directly decoding complete OD4 container failed, try decoding without header.
             cluon::FromProtoVisitor protoDecoder;
-            protoDecoder.decodeFrom(sstr, envelope);
+            protoDecoder.decodeFrom(protoEncodedEnvelope.data(), protoEncodedEnvelope.size(), envelope);
         }
 
         retVal = getJSONFromEnvelope(envelope);
@@ -83,9 +84,8 @@ std::string EnvelopeConverter::getJSONFromEnvelope(cluon::data::Envelope &envelo
             ToJSONVisitor envelopeToJSON{OUTER_CURLY_BRACES, mask};
             envelope.accept(envelopeToJSON);
 
-            std::stringstream sstr{envelope.serializedData()};
             cluon::FromProtoVisitor protoDecoder;
-            protoDecoder.decodeFrom(sstr);
+            protoDecoder.decodeFrom(envelope.serializedData().data(), envelope.serializedData().size());
 
             // Now, create JSON from payload.
             cluon::MetaMessage payload{m_scopeOfMetaMessages[envelope.dataType()]};
@@ -145,7 +145,7 @@ void FromJSONVisitor::preVisit(int32_t id, const std::string &shortName, const s
 
 void FromJSONVisitor::postVisit() noexcept {}
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -162,7 +162,7 @@ void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&n
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -175,7 +175,7 @@ void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&n
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -188,7 +188,7 @@ void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&n
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -201,7 +201,7 @@ void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&n
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -214,7 +214,7 @@ void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&n
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -227,7 +227,7 @@ void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&n
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -240,7 +240,7 @@ void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&n
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -253,7 +253,7 @@ void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&n
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -266,7 +266,7 @@ void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&n
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -279,7 +279,7 @@ void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&n
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -292,7 +292,7 @@ void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&n
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -305,7 +305,7 @@ void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&n
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
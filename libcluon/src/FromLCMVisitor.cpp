@@ -62,7 +62,7 @@ void FromLCMVisitor::postVisit() noexcept {
     }
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -71,7 +71,7 @@ void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     m_buffer.read(reinterpret_cast<char *>(&v), sizeof(bool));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -80,7 +80,7 @@ void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     m_buffer.read(reinterpret_cast<char *>(&v), sizeof(char));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -89,7 +89,7 @@ void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     m_buffer.read(reinterpret_cast<char *>(&v), sizeof(int8_t));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -98,7 +98,7 @@ void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     m_buffer.read(reinterpret_cast<char *>(&v), sizeof(int8_t));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -109,7 +109,7 @@ void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     v = static_cast<int16_t>(be16toh(_v));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -120,7 +120,7 @@ void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     v = be16toh(_v);
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -131,7 +131,7 @@ void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     v = static_cast<int32_t>(be32toh(_v));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -142,7 +142,7 @@ void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     v = be32toh(_v);
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -153,7 +153,7 @@ void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     v = static_cast<int64_t>(be64toh(_v));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -164,7 +164,7 @@ void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     v = be64toh(_v);
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -176,7 +176,7 @@ void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     std::memmove(&v, &_v, sizeof(int32_t));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -188,7 +188,7 @@ void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     std::memmove(&v, &_v, sizeof(int64_t));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)id;
     (void)typeName;
     (void)name;
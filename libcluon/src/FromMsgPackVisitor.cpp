@@ -269,7 +269,7 @@ void FromMsgPackVisitor::preVisit(int32_t id, const std::string &shortName, cons
 
 void FromMsgPackVisitor::postVisit() noexcept {}
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -280,7 +280,7 @@ void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -291,7 +291,7 @@ void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -307,7 +307,7 @@ void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -318,7 +318,7 @@ void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -334,7 +334,7 @@ void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -345,7 +345,7 @@ void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -361,7 +361,7 @@ void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -372,7 +372,7 @@ void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -388,7 +388,7 @@ void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -399,7 +399,7 @@ void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -410,7 +410,7 @@ void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
@@ -421,7 +421,7 @@ void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
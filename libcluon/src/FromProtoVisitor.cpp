@@ -7,6 +7,7 @@
  */
 
 #include "cluon/FromProtoVisitor.hpp"
+#include "cluon/VarInt.hpp"
 
 #include <cstddef>
 #include <cstring>
@@ -14,75 +15,161 @@
 
 namespace cluon {
 
-void FromProtoVisitor::readBytesFromStream(std::istream &in, std::size_t bytesToReadFromStream, char *buffer) noexcept {
-    if (nullptr != buffer) {
-        const constexpr std::size_t CHUNK_SIZE{1024};
-        std::streamsize bufferPosition{0};
-        std::streamsize extractedBytes{0};
-
-        while ((0 < bytesToReadFromStream) && in.good()) {
-            // clang-format off
-            in.read(&buffer[static_cast<std::size_t>(bufferPosition)], /* Flawfinder: ignore */ /* Cf. buffer.reserve(...) above.  */
-                    (bytesToReadFromStream > CHUNK_SIZE) ? CHUNK_SIZE : static_cast<std::streamsize>(bytesToReadFromStream));
-            // clang-format on
-            extractedBytes = in.gcount();
-            bufferPosition += extractedBytes;
-            bytesToReadFromStream -= static_cast<std::size_t>(extractedBytes);
+std::string FromProtoVisitor::readFromStream(std::istream &in) noexcept {
+    std::string data;
+    try {
+        constexpr std::size_t CHUNK_SIZE{1024};
+        std::array<char, CHUNK_SIZE> buffer;
+        while (in.good()) {
+            in.read(buffer.data(), static_cast<std::streamsize>(CHUNK_SIZE)); /* Flawfinder: ignore */ /* Cf. buffer's size. */
+            data.append(buffer.data(), static_cast<std::size_t>(in.gcount()));
         }
+    } catch (...) {} // LCOV_EXCL_LINE
+    return data;
+}
+
+bool FromProtoVisitor::readValue(const char *&data, const char *end) noexcept {
+    bool retVal{false};
+    const std::size_t AVAILABLE{static_cast<std::size_t>(end - data)};
+    // Only a length-delimited value refers to the source data.
+    m_lengthDelimitedData = nullptr;
+    switch (m_protoType) {
+        case ProtoConstants::VARINT:
+        {
+            retVal = (0 < fromVarInt(data, end, m_value));
+        }
+        break;
+        case ProtoConstants::EIGHT_BYTES:
+        {
+            if ((retVal = (sizeof(double) <= AVAILABLE))) {
+                std::memcpy(m_doubleValue.buffer.data(), data, sizeof(double));
+                m_doubleValue.uint64Value = le64toh(m_doubleValue.uint64Value);
+                data += sizeof(double);
+            }
+        }
+        break;
+        case ProtoConstants::FOUR_BYTES:
+        {
+            if ((retVal = (sizeof(float) <= AVAILABLE))) {
+                std::memcpy(m_floatValue.buffer.data(), data, sizeof(float));
+                m_floatValue.uint32Value = le32toh(m_floatValue.uint32Value);
+                data += sizeof(float);
+            }
+        }
+        break;
+        case ProtoConstants::LENGTH_DELIMITED:
+        {
+            if ((retVal = ((0 < fromVarInt(data, end, m_value)) && (m_value <= static_cast<uint64_t>(end - data))))) {
+                m_lengthDelimitedData = data;
+                data += m_value;
+            }
+        }
+        break;
     }
+    return retVal;
 }
 
 void FromProtoVisitor::decodeFrom(std::istream &in) noexcept {
-    // Reset internal states as this deserializer could be reused.
-    m_mapOfKeyValues.clear();
-    while (in.good()) {
-        // First stage: Read keyFieldType (encoded as VarInt).
-        if (0 < fromVarInt(in, m_keyFieldType)) {
+    const std::string DATA{readFromStream(in)};
+    decodeFrom(DATA.data(), DATA.size());
+}
+
+void FromProtoVisitor::decodeFrom(const char *data, std::size_t length) noexcept {
+    // Reset internal states as this deserializer could be reused; keep the allocated memory.
+    for (const auto &kv : m_keyValues) {
+        if (kv.fieldId < m_indexOfFieldId.size()) {
+            m_indexOfFieldId[kv.fieldId] = -1;
+        }
+    }
+    m_keyValues.clear();
+    m_lengthDelimitedValues.clear();
+
+    const char *end{data + length};
+    try {
+        while (data < end) {
+            // First stage: Read keyFieldType (encoded as VarInt).
+            if (0 == fromVarInt(data, end, m_keyFieldType)) {
+                break;
+            }
             // Succeeded to read keyFieldType entry; extract information.
             m_protoType = static_cast<ProtoConstants>(m_keyFieldType & 0x7);
             m_fieldId = static_cast<uint32_t>(m_keyFieldType >> 3);
+            if (!readValue(data, end)) {
+                break;
+            }
+
+            // Like for a map, only the first occurrence of a field is used.
+            if (0 <= indexOf(m_fieldId)) {
+                continue;
+            }
+            KeyValue kv;
+            kv.fieldId = m_fieldId;
+            kv.protoType = m_protoType;
             switch (m_protoType) {
                 case ProtoConstants::VARINT:
                 {
-                    // Directly decode VarInt value.
-                    fromVarInt(in, m_value);
-                    m_mapOfKeyValues.emplace(m_fieldId, linb::any(m_value));
+                    kv.value = m_value;
                 }
                 break;
                 case ProtoConstants::EIGHT_BYTES:
                 {
-                    readBytesFromStream(in, sizeof(double), m_doubleValue.buffer.data());
-                    m_doubleValue.uint64Value = le64toh(m_doubleValue.uint64Value);
-                    m_mapOfKeyValues.emplace(m_fieldId, linb::any(m_doubleValue.doubleValue));
+                    kv.value = m_doubleValue.uint64Value;
                 }
                 break;
                 case ProtoConstants::FOUR_BYTES:
                 {
-                    readBytesFromStream(in, sizeof(float), m_floatValue.buffer.data());
-                    m_floatValue.uint32Value = le32toh(m_floatValue.uint32Value);
-                    m_mapOfKeyValues.emplace(m_fieldId, linb::any(m_floatValue.floatValue));
+                    kv.value = m_floatValue.uint32Value;
                 }
                 break;
                 case ProtoConstants::LENGTH_DELIMITED:
                 {
-                    fromVarInt(in, m_value);
-                    const std::size_t BYTES_TO_READ_FROM_STREAM{static_cast<std::size_t>(m_value)};
-                    if (m_stringValue.capacity() < BYTES_TO_READ_FROM_STREAM) {
-                        m_stringValue.reserve(BYTES_TO_READ_FROM_STREAM);
-                    }
-                    readBytesFromStream(in, BYTES_TO_READ_FROM_STREAM, m_stringValue.data());
-                    m_mapOfKeyValues.emplace(m_fieldId, linb::any(std::string(m_stringValue.data(), static_cast<std::size_t>(m_value))));
+                    kv.offset = static_cast<uint32_t>(m_lengthDelimitedValues.size());
+                    kv.length = static_cast<uint32_t>(m_value);
+                    m_lengthDelimitedValues.append(m_lengthDelimitedData, static_cast<std::size_t>(m_value));
                 }
                 break;
             }
+            if (m_fieldId < MAX_DENSE_FIELD_ID) {
+                if (m_indexOfFieldId.size() <= m_fieldId) {
+                    m_indexOfFieldId.resize(m_fieldId + 1, -1);
+                }
+                m_indexOfFieldId[m_fieldId] = static_cast<int32_t>(m_keyValues.size());
+            }
+            m_keyValues.push_back(kv);
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+}
+
+int32_t FromProtoVisitor::indexOf(uint32_t fieldId) const noexcept {
+    int32_t retVal{-1};
+    if (fieldId < MAX_DENSE_FIELD_ID) {
+        if (fieldId < m_indexOfFieldId.size()) {
+            retVal = m_indexOfFieldId[fieldId];
+        }
+    } else {
+        for (std::size_t i{0}; (0 > retVal) && (i < m_keyValues.size()); i++) {
+            if (m_keyValues[i].fieldId == fieldId) {
+                retVal = static_cast<int32_t>(i);
+            }
         }
     }
+    return retVal;
+}
+
+const FromProtoVisitor::KeyValue *FromProtoVisitor::keyValue(uint32_t fieldId, ProtoConstants protoType) const noexcept {
+    const int32_t INDEX{indexOf(fieldId)};
+    const KeyValue *retVal{(0 <= INDEX) ? &m_keyValues[static_cast<std::size_t>(INDEX)] : nullptr};
+    return ((nullptr != retVal) && (protoType == retVal->protoType)) ? retVal : nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
 FromProtoVisitor &FromProtoVisitor::operator=(const FromProtoVisitor &other) noexcept {
-    m_mapOfKeyValues = other.m_mapOfKeyValues;
+    try {
+        m_keyValues             = other.m_keyValues;
+        m_lengthDelimitedValues = other.m_lengthDelimitedValues;
+        m_indexOfFieldId        = other.m_indexOfFieldId;
+    } catch (...) {} // LCOV_EXCL_LINE
     return *this;
 }
 
@@ -96,194 +183,174 @@ void FromProtoVisitor::preVisit(int32_t id, const std::string &shortName, const
 
 void FromProtoVisitor::postVisit() noexcept {}
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = (0 != m_value);
-    }
-    else if (m_mapOfKeyValues.count(id) > 0) {
-        try {
-            v = (0 != linb::any_cast<uint64_t>(m_mapOfKeyValues[id]));
-        } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = (0 != m_value);
         }
     }
+    else if (const KeyValue *kv = keyValue(id, ProtoConstants::VARINT)) {
+        v = (0 != kv->value);
+    }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<char>(m_value);
-    }
-    else if (m_mapOfKeyValues.count(id) > 0) {
-        try {
-            uint64_t _v = linb::any_cast<uint64_t>(m_mapOfKeyValues[id]);
-            v           = static_cast<char>(_v);
-        } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<char>(m_value);
         }
     }
+    else if (const KeyValue *kv = keyValue(id, ProtoConstants::VARINT)) {
+        v = static_cast<char>(kv->value);
+    }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<int8_t>(fromZigZag8(static_cast<uint8_t>(m_value)));
-    }
-    else if (m_mapOfKeyValues.count(id) > 0) {
-        try {
-            uint64_t _v = linb::any_cast<uint64_t>(m_mapOfKeyValues[id]);
-            v           = static_cast<int8_t>(fromZigZag8(static_cast<uint8_t>(_v)));
-        } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<int8_t>(fromZigZag8(static_cast<uint8_t>(m_value)));
         }
     }
+    else if (const KeyValue *kv = keyValue(id, ProtoConstants::VARINT)) {
+        v = static_cast<int8_t>(fromZigZag8(static_cast<uint8_t>(kv->value)));
+    }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<uint8_t>(m_value);
-    }
-    else if (m_mapOfKeyValues.count(id) > 0) {
-        try {
-            uint64_t _v = linb::any_cast<uint64_t>(m_mapOfKeyValues[id]);
-            v           = static_cast<uint8_t>(_v);
-        } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<uint8_t>(m_value);
         }
     }
+    else if (const KeyValue *kv = keyValue(id, ProtoConstants::VARINT)) {
+        v = static_cast<uint8_t>(kv->value);
+    }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<int16_t>(fromZigZag16(static_cast<uint16_t>(m_value)));
-    }
-    else if (m_mapOfKeyValues.count(id) > 0) {
-        try {
-            uint64_t _v = linb::any_cast<uint64_t>(m_mapOfKeyValues[id]);
-            v           = static_cast<int16_t>(fromZigZag16(static_cast<uint16_t>(_v)));
-        } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<int16_t>(fromZigZag16(static_cast<uint16_t>(m_value)));
         }
     }
+    else if (const KeyValue *kv = keyValue(id, ProtoConstants::VARINT)) {
+        v = static_cast<int16_t>(fromZigZag16(static_cast<uint16_t>(kv->value)));
+    }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<uint16_t>(m_value);
-    }
-    else if (m_mapOfKeyValues.count(id) > 0) {
-        try {
-            uint64_t _v = linb::any_cast<uint64_t>(m_mapOfKeyValues[id]);
-            v           = static_cast<uint16_t>(_v);
-        } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<uint16_t>(m_value);
         }
     }
+    else if (const KeyValue *kv = keyValue(id, ProtoConstants::VARINT)) {
+        v = static_cast<uint16_t>(kv->value);
+    }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<int32_t>(fromZigZag32(static_cast<uint32_t>(m_value)));
-    }
-    else if (m_mapOfKeyValues.count(id) > 0) {
-        try {
-            uint64_t _v = linb::any_cast<uint64_t>(m_mapOfKeyValues[id]);
-            v           = static_cast<int32_t>(fromZigZag32(static_cast<uint32_t>(_v)));
-        } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<int32_t>(fromZigZag32(static_cast<uint32_t>(m_value)));
         }
     }
+    else if (const KeyValue *kv = keyValue(id, ProtoConstants::VARINT)) {
+        v = static_cast<int32_t>(fromZigZag32(static_cast<uint32_t>(kv->value)));
+    }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<uint32_t>(m_value);
-    }
-    else if (m_mapOfKeyValues.count(id) > 0) {
-        try {
-            uint64_t _v = linb::any_cast<uint64_t>(m_mapOfKeyValues[id]);
-            v           = static_cast<uint32_t>(_v);
-        } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<uint32_t>(m_value);
         }
     }
+    else if (const KeyValue *kv = keyValue(id, ProtoConstants::VARINT)) {
+        v = static_cast<uint32_t>(kv->value);
+    }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<int64_t>(fromZigZag64(static_cast<uint64_t>(m_value)));
-    }
-    else if (m_mapOfKeyValues.count(id) > 0) {
-        try {
-            uint64_t _v = linb::any_cast<uint64_t>(m_mapOfKeyValues[id]);
-            v           = static_cast<int64_t>(fromZigZag64(_v));
-        } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<int64_t>(fromZigZag64(static_cast<uint64_t>(m_value)));
         }
     }
+    else if (const KeyValue *kv = keyValue(id, ProtoConstants::VARINT)) {
+        v = static_cast<int64_t>(fromZigZag64(kv->value));
+    }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = m_value;
-    }
-    else if (m_mapOfKeyValues.count(id) > 0) {
-        try {
-            v = linb::any_cast<uint64_t>(m_mapOfKeyValues[id]);
-        } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = m_value;
         }
     }
+    else if (const KeyValue *kv = keyValue(id, ProtoConstants::VARINT)) {
+        v = kv->value;
+    }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = m_floatValue.floatValue;
-    }
-    else if (m_mapOfKeyValues.count(id) > 0) {
-        try {
-            v = linb::any_cast<float>(m_mapOfKeyValues[id]);
-        } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+        if (ProtoConstants::FOUR_BYTES == m_protoType) {
+            v = m_floatValue.floatValue;
         }
     }
+    else if (const KeyValue *kv = keyValue(id, ProtoConstants::FOUR_BYTES)) {
+        const uint32_t BITS{static_cast<uint32_t>(kv->value)};
+        std::memcpy(&v, &BITS, sizeof(float));
+    }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = m_doubleValue.doubleValue;
-    }
-    else if (m_mapOfKeyValues.count(id) > 0) {
-        try {
-            v = linb::any_cast<double>(m_mapOfKeyValues[id]);
-        } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+        if (ProtoConstants::EIGHT_BYTES == m_protoType) {
+            v = m_doubleValue.doubleValue;
         }
     }
+    else if (const KeyValue *kv = keyValue(id, ProtoConstants::EIGHT_BYTES)) {
+        std::memcpy(&v, &kv->value, sizeof(double));
+    }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = std::string(m_stringValue.data(), static_cast<std::size_t>(m_value));
-    }
-    else if (m_mapOfKeyValues.count(id) > 0) {
-        try {
-            v = linb::any_cast<std::string>(m_mapOfKeyValues[id]);
-        } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
+        if (ProtoConstants::LENGTH_DELIMITED == m_protoType && (nullptr != m_lengthDelimitedData)) {
+            v.assign(m_lengthDelimitedData, static_cast<std::size_t>(m_value));
         }
     }
+    else if (const KeyValue *kv = keyValue(id, ProtoConstants::LENGTH_DELIMITED)) {
+        v.assign(m_lengthDelimitedValues.data() + kv->offset, kv->length);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -304,24 +371,10 @@ int64_t FromProtoVisitor::fromZigZag64(uint64_t v) noexcept {
     return static_cast<int64_t>((v >> 1) ^ -(v & 1));
 }
 
-std::size_t FromProtoVisitor::fromVarInt(std::istream &in, uint64_t &value) noexcept {
+std::size_t FromProtoVisitor::fromVarInt(const char *&data, const char *end, uint64_t &value) noexcept {
     value = 0;
-
-    constexpr uint64_t MASK  = 0x7f;
-    constexpr uint64_t SHIFT = 0x7;
-    constexpr uint64_t MSB   = 0x80;
-
-    std::size_t size = 0;
-    uint64_t C{0};
-    while (in.good()) {
-        auto x = in.get();
-        C = static_cast<uint64_t>(x);
-        value |= (C & MASK) << (SHIFT * size++);
-        if (!(C & MSB)) { // NOLINT
-            break;
-        }
-    }
-
-    return size;
+    const std::size_t SIZE{cluon::varint::decode(data, end, value)};
+    data += SIZE;
+    return SIZE;
 }
 } // namespace cluon
@@ -27,91 +27,91 @@ void GenericMessage::GenericMessageVisitor::preVisit(int32_t id, const std::stri
 
 void GenericMessage::GenericMessageVisitor::postVisit() noexcept {}
 
-void GenericMessage::GenericMessageVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void GenericMessage::GenericMessageVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     cluon::MetaMessage::MetaField mf;
     mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::BOOL_T).fieldDataTypeName(typeName).fieldName(name);
     m_intermediateDataRepresentation[mf.fieldIdentifier()] = linb::any{v};
     m_metaMessage.add(std::move(mf));
 }
 
-void GenericMessage::GenericMessageVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void GenericMessage::GenericMessageVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     cluon::MetaMessage::MetaField mf;
     mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::CHAR_T).fieldDataTypeName(typeName).fieldName(name);
     m_intermediateDataRepresentation[mf.fieldIdentifier()] = linb::any{v};
     m_metaMessage.add(std::move(mf));
 }
 
-void GenericMessage::GenericMessageVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void GenericMessage::GenericMessageVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     cluon::MetaMessage::MetaField mf;
     mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::INT8_T).fieldDataTypeName(typeName).fieldName(name);
     m_intermediateDataRepresentation[mf.fieldIdentifier()] = linb::any{v};
     m_metaMessage.add(std::move(mf));
 }
 
-void GenericMessage::GenericMessageVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void GenericMessage::GenericMessageVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     cluon::MetaMessage::MetaField mf;
     mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::UINT8_T).fieldDataTypeName(typeName).fieldName(name);
     m_intermediateDataRepresentation[mf.fieldIdentifier()] = linb::any{v};
     m_metaMessage.add(std::move(mf));
 }
 
-void GenericMessage::GenericMessageVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void GenericMessage::GenericMessageVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     cluon::MetaMessage::MetaField mf;
     mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::INT16_T).fieldDataTypeName(typeName).fieldName(name);
     m_intermediateDataRepresentation[mf.fieldIdentifier()] = linb::any{v};
     m_metaMessage.add(std::move(mf));
 }
 
-void GenericMessage::GenericMessageVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void GenericMessage::GenericMessageVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     cluon::MetaMessage::MetaField mf;
     mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::UINT16_T).fieldDataTypeName(typeName).fieldName(name);
     m_intermediateDataRepresentation[mf.fieldIdentifier()] = linb::any{v};
     m_metaMessage.add(std::move(mf));
 }
 
-void GenericMessage::GenericMessageVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void GenericMessage::GenericMessageVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     cluon::MetaMessage::MetaField mf;
     mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::INT32_T).fieldDataTypeName(typeName).fieldName(name);
     m_intermediateDataRepresentation[mf.fieldIdentifier()] = linb::any{v};
     m_metaMessage.add(std::move(mf));
 }
 
-void GenericMessage::GenericMessageVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void GenericMessage::GenericMessageVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     cluon::MetaMessage::MetaField mf;
     mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::UINT32_T).fieldDataTypeName(typeName).fieldName(name);
     m_intermediateDataRepresentation[mf.fieldIdentifier()] = linb::any{v};
     m_metaMessage.add(std::move(mf));
 }
 
-void GenericMessage::GenericMessageVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void GenericMessage::GenericMessageVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     cluon::MetaMessage::MetaField mf;
     mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::INT64_T).fieldDataTypeName(typeName).fieldName(name);
     m_intermediateDataRepresentation[mf.fieldIdentifier()] = linb::any{v};
     m_metaMessage.add(std::move(mf));
 }
 
-void GenericMessage::GenericMessageVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void GenericMessage::GenericMessageVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     cluon::MetaMessage::MetaField mf;
     mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::UINT64_T).fieldDataTypeName(typeName).fieldName(name);
     m_intermediateDataRepresentation[mf.fieldIdentifier()] = linb::any{v};
     m_metaMessage.add(std::move(mf));
 }
 
-void GenericMessage::GenericMessageVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void GenericMessage::GenericMessageVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     cluon::MetaMessage::MetaField mf;
     mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::FLOAT_T).fieldDataTypeName(typeName).fieldName(name);
     m_intermediateDataRepresentation[mf.fieldIdentifier()] = linb::any{v};
     m_metaMessage.add(std::move(mf));
 }
 
-void GenericMessage::GenericMessageVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void GenericMessage::GenericMessageVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     cluon::MetaMessage::MetaField mf;
     mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::DOUBLE_T).fieldDataTypeName(typeName).fieldName(name);
     m_intermediateDataRepresentation[mf.fieldIdentifier()] = linb::any{v};
     m_metaMessage.add(std::move(mf));
 }
 
-void GenericMessage::GenericMessageVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void GenericMessage::GenericMessageVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     cluon::MetaMessage::MetaField mf;
     mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::STRING_T).fieldDataTypeName(typeName).fieldName(name);
     m_intermediateDataRepresentation[mf.fieldIdentifier()] = linb::any{v};
@@ -153,7 +153,7 @@ void GenericMessage::preVisit(int32_t id, const std::string &shortName, const st
 
 void GenericMessage::postVisit() noexcept {}
 
-void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void GenericMessage::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)typeName;
     (void)name;
     if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -164,7 +164,7 @@ void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&na
     }
 }
 
-void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void GenericMessage::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)typeName;
     (void)name;
     if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -175,7 +175,7 @@ void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&na
     }
 }
 
-void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void GenericMessage::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -186,7 +186,7 @@ void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&na
     }
 }
 
-void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void GenericMessage::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -197,7 +197,7 @@ void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&na
     }
 }
 
-void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void GenericMessage::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -208,7 +208,7 @@ void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&na
     }
 }
 
-void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void GenericMessage::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -219,7 +219,7 @@ void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&na
     }
 }
 
-void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void GenericMessage::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -230,7 +230,7 @@ void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&na
     }
 }
 
-void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void GenericMessage::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -241,7 +241,7 @@ void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&na
     }
 }
 
-void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void GenericMessage::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -252,7 +252,7 @@ void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&na
     }
 }
 
-void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void GenericMessage::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -263,7 +263,7 @@ void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&na
     }
 }
 
-void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void GenericMessage::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)typeName;
     (void)name;
     if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -274,7 +274,7 @@ void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&na
     }
 }
 
-void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void GenericMessage::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)typeName;
     (void)name;
     if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -285,7 +285,7 @@ void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&na
     }
 }
 
-void GenericMessage::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void GenericMessage::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)typeName;
     (void)name;
     if (0 < m_intermediateDataRepresentation.count(id)) {
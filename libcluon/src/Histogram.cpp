@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "cluon/Histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace cluon {
+
+constexpr std::size_t Histogram::SUB_BUCKETS;
+constexpr std::size_t Histogram::HALF_SUB_BUCKETS;
+constexpr std::size_t Histogram::NUMBER_OF_BUCKETS;
+
+Histogram::Histogram() noexcept {
+    for (auto &b : m_buckets) { b.store(0, std::memory_order_relaxed); }
+}
+
+std::size_t Histogram::indexOf(uint64_t value) noexcept {
+    if (value < SUB_BUCKETS) {
+        return static_cast<std::size_t>(value);
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    const uint32_t MSB{static_cast<uint32_t>(63 - __builtin_clzll(value))};
+#else
+    uint32_t MSB{0};
+    for (uint64_t v{value}; v > 1; v >>= 1) { MSB++; }
+#endif
+    // Values in [2^MSB, 2^(MSB+1)) are split into HALF_SUB_BUCKETS buckets.
+    const uint32_t SHIFT{MSB - 4};
+    return SUB_BUCKETS + (SHIFT - 1) * HALF_SUB_BUCKETS + static_cast<std::size_t>((value >> SHIFT) - HALF_SUB_BUCKETS);
+}
+
+uint64_t Histogram::highestValueOf(std::size_t index) noexcept {
+    if (index < SUB_BUCKETS) {
+        return static_cast<uint64_t>(index);
+    }
+    const uint64_t SHIFT{(index - SUB_BUCKETS) / HALF_SUB_BUCKETS + 1};
+    const uint64_t SUB{(index - SUB_BUCKETS) % HALF_SUB_BUCKETS + HALF_SUB_BUCKETS};
+    return ((SUB + 1) << SHIFT) - 1;
+}
+
+void Histogram::record(int64_t value) noexcept {
+    value = std::max<int64_t>(value, 0);
+    m_buckets[indexOf(static_cast<uint64_t>(value))].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(static_cast<uint64_t>(value), std::memory_order_relaxed);
+
+    int64_t current{m_min.load(std::memory_order_relaxed)};
+    while ((value < current) && !m_min.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    current = m_max.load(std::memory_order_relaxed);
+    while ((value > current) && !m_max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+
+    // Increment the count last so that readers see consistent percentiles.
+    m_count.fetch_add(1, std::memory_order_release);
+}
+
+void Histogram::reset() noexcept {
+    m_count.store(0, std::memory_order_relaxed);
+    for (auto &b : m_buckets) { b.store(0, std::memory_order_relaxed); }
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(INT64_MAX, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+uint64_t Histogram::count() const noexcept {
+    return m_count.load(std::memory_order_acquire);
+}
+
+int64_t Histogram::min() const noexcept {
+    return (0 == count() ? 0 : m_min.load(std::memory_order_relaxed));
+}
+
+int64_t Histogram::max() const noexcept {
+    return m_max.load(std::memory_order_relaxed);
+}
+
+double Histogram::mean() const noexcept {
+    const uint64_t COUNT{count()};
+    return (0 == COUNT ? 0.0 : static_cast<double>(m_sum.load(std::memory_order_relaxed)) / static_cast<double>(COUNT));
+}
+
+int64_t Histogram::percentile(double p) const noexcept {
+    const uint64_t COUNT{count()};
+    if (0 == COUNT) {
+        return 0;
+    }
+    p = std::min(std::max(p, 0.0), 100.0);
+    const uint64_t RANK{std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(COUNT))))};
+
+    uint64_t sum{0};
+    for (std::size_t i{0}; i < NUMBER_OF_BUCKETS; i++) {
+        sum += m_buckets[i].load(std::memory_order_relaxed);
+        if (sum >= RANK) {
+            // Do not report more than the largest recorded value.
+            return std::min(static_cast<int64_t>(std::min<uint64_t>(highestValueOf(i), INT64_MAX)), max());
+        }
+    }
+    return max(); // LCOV_EXCL_LINE
+}
+
+} // namespace cluon
@@ -34,16 +34,16 @@ const char *headerFileTemplate = R"(
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -52,9 +52,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -67,17 +73,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -91,14 +97,248 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
 
-#ifndef {{%HEADER_GUARD%}}_HPP
+{{#%PROTO_CODEC%}}#ifndef PROTO_CODEC
+#define PROTO_CODEC
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+// Encoding and decoding of fields in Proto format as done by cluon::ToProtoVisitor and cluon::FromProtoVisitor.
+namespace protoCodec {
+inline std::size_t sizeOfVarInt(uint64_t v) noexcept {
+    std::size_t size{1};
+    while (0x7f < v) {
+        v >>= 7;
+        size++;
+    }
+    return size;
+}
+
+inline char *encodeVarInt(char *out, uint64_t v) noexcept {
+    while (0x7f < v) {
+        *out++ = static_cast<char>((v & 0x7f) | 0x80);
+        v >>= 7;
+    }
+    *out++ = static_cast<char>(v);
+    return out;
+}
+
+inline bool decodeVarInt(const char *&data, const char *end, uint64_t &v) noexcept {
+    if ((data < end) && (static_cast<uint8_t>(*data) < 0x80)) {
+        v = static_cast<uint8_t>(*data++);
+        return true;
+    }
+    v = 0;
+    for (uint32_t shift{0}; (data < end) && (shift < 64); shift += 7) {
+        const uint64_t C{static_cast<uint8_t>(*data++)};
+        v |= (C & 0x7f) << shift;
+        if (C < 0x80) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline uint64_t toZigZag(int8_t v) noexcept {
+    return static_cast<uint8_t>((static_cast<uint32_t>(v) << 1) ^ static_cast<uint32_t>(v >> 7));
+}
+inline uint64_t toZigZag(int16_t v) noexcept {
+    return static_cast<uint16_t>((static_cast<uint32_t>(v) << 1) ^ static_cast<uint32_t>(v >> 15));
+}
+inline uint64_t toZigZag(int32_t v) noexcept {
+    return static_cast<uint32_t>((static_cast<uint32_t>(v) << 1) ^ static_cast<uint32_t>(v >> 31));
+}
+inline uint64_t toZigZag(int64_t v) noexcept {
+    return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
+template<typename T>
+inline T fromZigZag(uint64_t v) noexcept {
+    const typename std::make_unsigned<T>::type V{static_cast<typename std::make_unsigned<T>::type>(v)};
+    return static_cast<T>((V >> 1) ^ (~(V & 1) + 1));
+}
+
+template<typename T>
+inline char *encodeFixed(char *out, T bits) noexcept {
+    // Little endian encoding.
+    for (std::size_t i{0}; i < sizeof(T); i++) {
+        *out++ = static_cast<char>(bits >> (8 * i));
+    }
+    return out;
+}
+
+template<typename T>
+inline bool decodeFixed(const char *&data, const char *end, T &bits) noexcept {
+    if (static_cast<std::size_t>(end - data) < sizeof(T)) {
+        return false;
+    }
+    bits = 0;
+    for (std::size_t i{0}; i < sizeof(T); i++) {
+        bits = static_cast<T>(bits | (static_cast<T>(static_cast<uint8_t>(*data++)) << (8 * i)));
+    }
+    return true;
+}
+
+inline std::size_t sizeOfValue(const bool &) noexcept { return 1; }
+inline std::size_t sizeOfValue(const char &v) noexcept { return sizeOfVarInt(static_cast<uint8_t>(v)); }
+inline std::size_t sizeOfValue(const int8_t &v) noexcept { return sizeOfVarInt(toZigZag(v)); }
+inline std::size_t sizeOfValue(const uint8_t &v) noexcept { return sizeOfVarInt(v); }
+inline std::size_t sizeOfValue(const int16_t &v) noexcept { return sizeOfVarInt(toZigZag(v)); }
+inline std::size_t sizeOfValue(const uint16_t &v) noexcept { return sizeOfVarInt(v); }
+inline std::size_t sizeOfValue(const int32_t &v) noexcept { return sizeOfVarInt(toZigZag(v)); }
+inline std::size_t sizeOfValue(const uint32_t &v) noexcept { return sizeOfVarInt(v); }
+inline std::size_t sizeOfValue(const int64_t &v) noexcept { return sizeOfVarInt(toZigZag(v)); }
+inline std::size_t sizeOfValue(const uint64_t &v) noexcept { return sizeOfVarInt(v); }
+inline std::size_t sizeOfValue(const float &) noexcept { return sizeof(uint32_t); }
+inline std::size_t sizeOfValue(const double &) noexcept { return sizeof(uint64_t); }
+inline std::size_t sizeOfValue(const std::string &v) noexcept { return sizeOfVarInt(v.size()) + v.size(); }
+template<typename T>
+inline std::size_t sizeOfValue(const T &v) noexcept {
+    const std::size_t SIZE{v.protoSize()};
+    return sizeOfVarInt(SIZE) + SIZE;
+}
+
+inline char *encodeValue(char *out, const bool &v) noexcept { return encodeVarInt(out, v ? 1 : 0); }
+inline char *encodeValue(char *out, const char &v) noexcept { return encodeVarInt(out, static_cast<uint8_t>(v)); }
+inline char *encodeValue(char *out, const int8_t &v) noexcept { return encodeVarInt(out, toZigZag(v)); }
+inline char *encodeValue(char *out, const uint8_t &v) noexcept { return encodeVarInt(out, v); }
+inline char *encodeValue(char *out, const int16_t &v) noexcept { return encodeVarInt(out, toZigZag(v)); }
+inline char *encodeValue(char *out, const uint16_t &v) noexcept { return encodeVarInt(out, v); }
+inline char *encodeValue(char *out, const int32_t &v) noexcept { return encodeVarInt(out, toZigZag(v)); }
+inline char *encodeValue(char *out, const uint32_t &v) noexcept { return encodeVarInt(out, v); }
+inline char *encodeValue(char *out, const int64_t &v) noexcept { return encodeVarInt(out, toZigZag(v)); }
+inline char *encodeValue(char *out, const uint64_t &v) noexcept { return encodeVarInt(out, v); }
+inline char *encodeValue(char *out, const float &v) noexcept {
+    uint32_t bits{0};
+    std::memcpy(&bits, &v, sizeof(float));
+    return encodeFixed(out, bits);
+}
+inline char *encodeValue(char *out, const double &v) noexcept {
+    uint64_t bits{0};
+    std::memcpy(&bits, &v, sizeof(double));
+    return encodeFixed(out, bits);
+}
+inline char *encodeValue(char *out, const std::string &v) noexcept {
+    out = encodeVarInt(out, v.size());
+    std::memcpy(out, v.data(), v.size());
+    return out + v.size();
+}
+template<typename T>
+inline char *encodeValue(char *out, const T &v) noexcept {
+    return v.encodeProto(encodeVarInt(out, v.protoSize()));
+}
+
+template<typename T>
+inline bool decodeVarIntValue(const char *&data, const char *end, T &v) noexcept {
+    uint64_t value{0};
+    const bool retVal{decodeVarInt(data, end, value)};
+    v = static_cast<T>(value);
+    return retVal;
+}
+template<typename T>
+inline bool decodeZigZagValue(const char *&data, const char *end, T &v) noexcept {
+    uint64_t value{0};
+    const bool retVal{decodeVarInt(data, end, value)};
+    v = fromZigZag<T>(value);
+    return retVal;
+}
+
+inline bool decodeValue(const char *&data, const char *end, bool &v) noexcept {
+    uint64_t value{0};
+    const bool retVal{decodeVarInt(data, end, value)};
+    v = (0 != value);
+    return retVal;
+}
+inline bool decodeValue(const char *&data, const char *end, char &v) noexcept { return decodeVarIntValue(data, end, v); }
+inline bool decodeValue(const char *&data, const char *end, int8_t &v) noexcept { return decodeZigZagValue(data, end, v); }
+inline bool decodeValue(const char *&data, const char *end, uint8_t &v) noexcept { return decodeVarIntValue(data, end, v); }
+inline bool decodeValue(const char *&data, const char *end, int16_t &v) noexcept { return decodeZigZagValue(data, end, v); }
+inline bool decodeValue(const char *&data, const char *end, uint16_t &v) noexcept { return decodeVarIntValue(data, end, v); }
+inline bool decodeValue(const char *&data, const char *end, int32_t &v) noexcept { return decodeZigZagValue(data, end, v); }
+inline bool decodeValue(const char *&data, const char *end, uint32_t &v) noexcept { return decodeVarIntValue(data, end, v); }
+inline bool decodeValue(const char *&data, const char *end, int64_t &v) noexcept { return decodeZigZagValue(data, end, v); }
+inline bool decodeValue(const char *&data, const char *end, uint64_t &v) noexcept { return decodeVarInt(data, end, v); }
+inline bool decodeValue(const char *&data, const char *end, float &v) noexcept {
+    uint32_t bits{0};
+    const bool retVal{decodeFixed(data, end, bits)};
+    if (retVal) {
+        std::memcpy(&v, &bits, sizeof(float));
+    }
+    return retVal;
+}
+inline bool decodeValue(const char *&data, const char *end, double &v) noexcept {
+    uint64_t bits{0};
+    const bool retVal{decodeFixed(data, end, bits)};
+    if (retVal) {
+        std::memcpy(&v, &bits, sizeof(double));
+    }
+    return retVal;
+}
+inline bool decodeLength(const char *&data, const char *end, uint64_t &length) noexcept {
+    return decodeVarInt(data, end, length) && (length <= static_cast<uint64_t>(end - data));
+}
+inline bool decodeValue(const char *&data, const char *end, std::string &v) noexcept {
+    uint64_t length{0};
+    const bool retVal{decodeLength(data, end, length)};
+    if (retVal) {
+        v.assign(data, static_cast<std::size_t>(length));
+        data += length;
+    }
+    return retVal;
+}
+template<typename T>
+inline bool decodeValue(const char *&data, const char *end, T &v) noexcept {
+    uint64_t length{0};
+    const bool retVal{decodeLength(data, end, length) && v.decodeProto(data, static_cast<std::size_t>(length))};
+    data += (retVal ? length : 0);
+    return retVal;
+}
+
+inline bool skipValue(const char *&data, const char *end, uint64_t key) noexcept {
+    bool retVal{false};
+    uint64_t value{0};
+    switch (key & 0x7) {
+        case 0: // VarInt.
+            retVal = decodeVarInt(data, end, value);
+            break;
+        case 1: // Eight bytes.
+            retVal = decodeFixed(data, end, value);
+            break;
+        case 2: // Length delimited.
+            if ((retVal = decodeLength(data, end, value))) {
+                data += value;
+            }
+            break;
+        case 5: // Four bytes.
+        {
+            uint32_t bits{0};
+            retVal = decodeFixed(data, end, bits);
+        }
+            break;
+        default:
+            break;
+    }
+    return retVal;
+}
+} // namespace protoCodec
+#endif
+
+{{/%PROTO_CODEC%}}#ifndef {{%HEADER_GUARD%}}_HPP
 #define {{%HEADER_GUARD%}}_HPP
 
 #ifdef WIN32
@@ -131,11 +371,13 @@ class LIB_API {{%MESSAGE%}} {
         inline static int32_t ID() {
             return {{%IDENTIFIER%}};
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -165,7 +407,7 @@ class LIB_API {{%MESSAGE%}} {
 //            visitor.preVisit(ID(), ShortName(), LongName());
             {{#%FIELDS%}}
             if ({{%FIELDIDENTIFIER%}} == fieldId) {
-                doVisit({{%FIELDIDENTIFIER%}}, std::move("{{%TYPE%}}"s), std::move("{{%NAME%}}"s), m_{{%NAME%}}, visitor);
+                doVisit({{%FIELDIDENTIFIER%}}, "{{%TYPE%}}", "{{%NAME%}}", m_{{%NAME%}}, visitor);
                 return;
             }
             {{/%FIELDS%}}
@@ -176,7 +418,7 @@ class LIB_API {{%MESSAGE%}} {
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
             {{#%FIELDS%}}
-            doVisit({{%FIELDIDENTIFIER%}}, std::move("{{%TYPE%}}"s), std::move("{{%NAME%}}"s), m_{{%NAME%}}, visitor);
+            doVisit({{%FIELDIDENTIFIER%}}, "{{%TYPE%}}", "{{%NAME%}}", m_{{%NAME%}}, visitor);
             {{/%FIELDS%}}
             visitor.postVisit();
         }
@@ -186,11 +428,77 @@ class LIB_API {{%MESSAGE%}} {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
             {{#%FIELDS%}}
-            doTripletForwardVisit({{%FIELDIDENTIFIER%}}, std::move("{{%TYPE%}}"s), std::move("{{%NAME%}}"s), m_{{%NAME%}}, preVisit, visit, postVisit);
+            doTripletForwardVisit({{%FIELDIDENTIFIER%}}, "{{%TYPE%}}", "{{%NAME%}}", m_{{%NAME%}}, preVisit, visit, postVisit);
             {{/%FIELDS%}}
             std::forward<PostVisitor>(postVisit)();
         }
+{{#%PROTO_CODEC%}}
 
+    public:
+        /**
+         * @return Size of this message in Proto format in bytes.
+         */
+        inline std::size_t protoSize() const noexcept {
+            std::size_t size{0};
+            {{#%FIELDS%}}
+            size += protoCodec::sizeOfVarInt({{%PROTO_KEY%}}) + protoCodec::sizeOfValue(m_{{%NAME%}});
+            {{/%FIELDS%}}
+            return size;
+        }
+
+        /**
+         * This method encodes this message in Proto format.
+         *
+         * @param out Buffer with at least protoSize() bytes.
+         * @return Pointer behind the encoded data.
+         */
+        inline char *encodeProto(char *out) const noexcept {
+            {{#%FIELDS%}}
+            out = protoCodec::encodeValue(protoCodec::encodeVarInt(out, {{%PROTO_KEY%}}), m_{{%NAME%}});
+            {{/%FIELDS%}}
+            return out;
+        }
+
+        /**
+         * This method appends this message in Proto format to buffer.
+         *
+         * @param buffer Buffer to append the encoded data to.
+         */
+        inline void encodeProto(std::string &buffer) const {
+            const std::size_t OFFSET{buffer.size()};
+            buffer.resize(OFFSET + protoSize());
+            encodeProto(&buffer[OFFSET]);
+        }
+
+        /**
+         * This method decodes this message from Proto format. Fields that are
+         * not contained in data keep their values; unknown fields are skipped.
+         *
+         * @param data Pointer to the Proto-encoded data.
+         * @param size Size of the Proto-encoded data in bytes.
+         * @return true if data was decoded completely.
+         */
+        inline bool decodeProto(const char *data, std::size_t size) noexcept {
+            const char *end{data + size};
+            bool retVal{true};
+            while (retVal && (data < end)) {
+                uint64_t key{0};
+                if ((retVal = protoCodec::decodeVarInt(data, end, key))) {
+                    switch (key) {
+                        {{#%FIELDS%}}
+                        case {{%PROTO_KEY%}}:
+                            retVal = protoCodec::decodeValue(data, end, m_{{%NAME%}});
+                            break;
+                        {{/%FIELDS%}}
+                        default:
+                            retVal = protoCodec::skipValue(data, end, key);
+                            break;
+                    }
+                }
+            }
+            return retVal;
+        }
+{{/%PROTO_CODEC%}}
     private:
         {{#%FIELDS%}}
         {{%TYPE%}} m_{{%NAME%}}{ {{%FIELD_DEFAULT_INITIALIZATION_VALUE%}}{{%INITIALIZER_SUFFIX%}} }; // field identifier = {{%FIELDIDENTIFIER%}}.
@@ -209,8 +517,12 @@ struct isTripletForwardVisitable<{{%COMPLETEPACKAGENAME_WITH_COLON_SEPARATORS%}}
 #endif
 )";
 
+MetaMessageToCPPTransformator::MetaMessageToCPPTransformator(bool withProtoCodec) noexcept
+    : m_withProtoCodec{withProtoCodec} {}
+
 std::string MetaMessageToCPPTransformator::content() noexcept {
     m_dataToBeRendered.set("%FIELDS%", m_fields);
+    m_dataToBeRendered.set("%PROTO_CODEC%", kainjow::mustache::data{m_withProtoCodec});
 
     kainjow::mustache::mustache tmpl{headerFileTemplate};
     // Reset Mustache's default string-escaper.
@@ -286,6 +598,19 @@ void MetaMessageToCPPTransformator::visit(const MetaMessage &mm) noexcept {
         dataToBeRendered.set("%NAMESPACE_CLOSING%", namespaceFooter);
         dataToBeRendered.set("%IDENTIFIER%", std::to_string(mm.messageIdentifier()));
 
+        // Wire types as in cluon::ProtoConstants.
+        auto protoTypeOf = [](MetaMessage::MetaField::MetaFieldDataTypes type) {
+            uint32_t protoType{0};
+            if (MetaMessage::MetaField::FLOAT_T == type) {
+                protoType = 5;
+            } else if (MetaMessage::MetaField::DOUBLE_T == type) {
+                protoType = 1;
+            } else if ((MetaMessage::MetaField::STRING_T == type) || (MetaMessage::MetaField::BYTES_T == type) || (MetaMessage::MetaField::MESSAGE_T == type)) {
+                protoType = 2;
+            }
+            return protoType;
+        };
+
         for (const auto &e : mm.listOfMetaFields()) {
             std::string fieldName{std::regex_replace(e.fieldName(), std::regex("\\."), "_")}; // NOLINT
             kainjow::mustache::data fieldEntry;
@@ -311,6 +636,7 @@ void MetaMessageToCPPTransformator::visit(const MetaMessage &mm) noexcept {
                 fieldEntry.set("%TYPE%", completeDataTypeNameWithDoubleColons);
             }
             fieldEntry.set("%FIELDIDENTIFIER%", std::to_string(e.fieldIdentifier()));
+            fieldEntry.set("%PROTO_KEY%", std::to_string((e.fieldIdentifier() << 0x3) | protoTypeOf(e.fieldDataType())));
 
             fields.push_back(fieldEntry);
         }
@@ -9,28 +9,724 @@
 #include "cluon/OD4Session.hpp"
 #include "cluon/Envelope.hpp"
 #include "cluon/FromProtoVisitor.hpp"
+#include "cluon/Histogram.hpp"
 #include "cluon/TerminateHandler.hpp"
 #include "cluon/Time.hpp"
+#include "cluon/UDPPacketSizeConstraints.hpp"
 
+// clang-format off
+#ifdef __linux__
+    #include <linux/filter.h>
+#endif
+#ifndef WIN32
+    #include <arpa/inet.h>
+    #include <ifaddrs.h>
+    #include <netinet/in.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+// clang-format on
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
 #include <iostream>
+#include <random>
+#include <set>
 #include <sstream>
 #include <thread>
+#include <vector>
 
 namespace cluon {
 
+namespace {
+/**
+ * This registry keeps track of all OD4Sessions in this process to exchange
+ * Envelopes in memory between OD4Sessions sharing the same CID.
+ */
+class InProcessRegistry {
+   public:
+    static InProcessRegistry &instance() noexcept {
+        static InProcessRegistry registry;
+        return registry;
+    }
+
+    /**
+     * @return UDPSender that is shared among all OD4Sessions with the given CID
+     *         in this process so that their UDPReceivers can filter out all
+     *         bytes that have been sent from this process.
+     */
+    std::shared_ptr<cluon::UDPSender> sender(uint16_t CID) noexcept {
+        std::shared_ptr<cluon::UDPSender> s;
+        try {
+            std::lock_guard<std::mutex> lck(m_mutex);
+            s = m_senders[CID].lock();
+            if (!s) {
+                s               = std::make_shared<cluon::UDPSender>("225.0.0." + std::to_string(CID), 12175);
+                m_senders[CID] = s;
+            }
+        } catch (...) {} // LCOV_EXCL_LINE
+        return s;
+    }
+
+    void add(uint16_t CID, const std::shared_ptr<cluon::NotifyingPipeline<cluon::data::Envelope>> &pipeline) noexcept {
+        try {
+            std::lock_guard<std::mutex> lck(m_mutex);
+            m_pipelines[CID].push_back(pipeline);
+        } catch (...) {} // LCOV_EXCL_LINE
+    }
+
+    void remove(uint16_t CID, const std::shared_ptr<cluon::NotifyingPipeline<cluon::data::Envelope>> &pipeline) noexcept {
+        try {
+            std::lock_guard<std::mutex> lck(m_mutex);
+            auto &pipelines = m_pipelines[CID];
+            pipelines.erase(std::remove(pipelines.begin(), pipelines.end(), pipeline), pipelines.end());
+        } catch (...) {} // LCOV_EXCL_LINE
+    }
+
+    /**
+     * This method hands over a copy of the given Envelope to all in-process
+     * OD4Sessions with the given CID except for the sending one. The copies
+     * are added while holding the lock so that no pipeline is destroyed
+     * concurrently.
+     */
+    void send(uint16_t CID, const std::shared_ptr<cluon::NotifyingPipeline<cluon::data::Envelope>> &from, const cluon::data::Envelope &envelope) noexcept {
+        try {
+            std::lock_guard<std::mutex> lck(m_mutex);
+            auto entry = m_pipelines.find(CID);
+            if (entry != m_pipelines.end()) {
+                for (auto &pipeline : entry->second) {
+                    if (pipeline != from) {
+                        cluon::data::Envelope env{envelope};
+                        pipeline->add(std::move(env));
+                        pipeline->notifyAll();
+                    }
+                }
+            }
+        } catch (...) {} // LCOV_EXCL_LINE
+    }
+
+   private:
+    std::mutex m_mutex{};
+    std::unordered_map<uint16_t, std::weak_ptr<cluon::UDPSender>> m_senders{};
+    std::unordered_map<uint16_t, std::vector<std::shared_ptr<cluon::NotifyingPipeline<cluon::data::Envelope>>>> m_pipelines{};
+};
+
+/**
+ * @param address Numerical IPv4 address.
+ * @return true if the given address belongs to one of this host's network interfaces.
+ */
+bool isLocalAddress(const std::string &address) noexcept {
+#ifdef WIN32
+    (void)address;
+    return false;
+#else
+    static std::set<std::string> listOfLocalIPAddresses = []() {
+        std::set<std::string> list;
+        struct ifaddrs *interfaceAddress{nullptr};
+        if (0 == ::getifaddrs(&interfaceAddress)) {
+            for (struct ifaddrs *it = interfaceAddress; nullptr != it; it = it->ifa_next) {
+                if ((nullptr != it->ifa_addr) && (it->ifa_addr->sa_family == AF_INET)) {
+                    char buffer[INET_ADDRSTRLEN];
+                    if (nullptr != ::inet_ntop(AF_INET, &(reinterpret_cast<struct sockaddr_in *>(it->ifa_addr)->sin_addr), buffer, INET_ADDRSTRLEN)) { // NOLINT
+                        list.insert(std::string(buffer));
+                    }
+                }
+            }
+            ::freeifaddrs(interfaceAddress);
+        }
+        return list;
+    }();
+    return (listOfLocalIPAddresses.count(address) > 0);
+#endif
+}
+
+// Time in microseconds after the last Envelope from a single-group peer until
+// a partitioned OD4Session stops sending copies to the single group.
+constexpr int64_t SINGLE_GROUP_PEER_TIMEOUT{10 * 1000 * 1000};
+
+/**
+ * @return Name of the shared memory pool of the OD4Session with the given sourceIdentifier.
+ */
+inline std::string nameOfSharedMemoryPool(uint16_t CID, uint32_t sourceIdentifier) noexcept {
+    std::string name;
+    try {
+        name = "/cluon-od4-" + std::to_string(CID) + "-" + std::to_string(sourceIdentifier);
+    } catch (...) {} // LCOV_EXCL_LINE
+    return name;
+}
+
+/**
+ * @return Partition for the given dataType.
+ */
+inline uint8_t partitionOf(int32_t dataType, uint8_t numberOfPartitions) noexcept {
+    return static_cast<uint8_t>(static_cast<uint32_t>(dataType) % numberOfPartitions);
+}
+
+#ifdef __linux__
+/**
+ * This function generates a classic BPF program that accepts only those
+ * OD4 Envelopes carrying one of the given dataTypes. As ToProtoVisitor
+ * encodes the Envelope's fields in order, every Envelope starts after the
+ * OD4 header with the key and the varint-encoded value of field 1 (dataType).
+ * Datagrams without an OD4 header are accepted to be handled in user space.
+ *
+ * @param listOfDataTypes dataTypes to accept.
+ * @return BPF program or an empty program if the dataTypes do not fit into one.
+ */
+std::vector<cluon::UDPReceiver::FilterInstruction> socketFilterFor(const std::vector<int32_t> &listOfDataTypes) noexcept {
+    // The socket filter sees the UDP header in front of the payload.
+    constexpr uint32_t UDP_HEADER{8};
+    constexpr uint32_t OD4_HEADER{5};
+    constexpr uint32_t ACCEPT{0xFFFFFFFF};
+    constexpr uint32_t DROP{0};
+
+    std::vector<cluon::UDPReceiver::FilterInstruction> program;
+    try {
+        // Bytes 0 and 1 of the OD4 header are 0x0D and 0xA4.
+        program.push_back({BPF_LD | BPF_B | BPF_ABS, 0, 0, UDP_HEADER});
+        program.push_back({BPF_JMP | BPF_JEQ | BPF_K, 1, 0, 0x0D});
+        program.push_back({BPF_RET | BPF_K, 0, 0, ACCEPT});
+        program.push_back({BPF_LD | BPF_B | BPF_ABS, 0, 0, UDP_HEADER + 1});
+        program.push_back({BPF_JMP | BPF_JEQ | BPF_K, 1, 0, 0xA4});
+        program.push_back({BPF_RET | BPF_K, 0, 0, ACCEPT});
+
+        for (int32_t dataType : listOfDataTypes) {
+            cluon::ToProtoVisitor protoEncoder;
+            protoEncoder.visit(1, "", "", dataType);
+            const std::string PREFIX{protoEncoder.encodedData()};
+
+            // Compare the prefix byte by byte; on mismatch, continue with the block for the next dataType.
+            const uint32_t LENGTH{static_cast<uint32_t>(PREFIX.size())};
+            for (uint32_t i{0}; i < LENGTH; i++) {
+                program.push_back({BPF_LD | BPF_B | BPF_ABS, 0, 0, UDP_HEADER + OD4_HEADER + i});
+                program.push_back({BPF_JMP | BPF_JEQ | BPF_K, 0, static_cast<uint8_t>(2 * (LENGTH - i) - 1), static_cast<uint8_t>(PREFIX[i])});
+            }
+            program.push_back({BPF_RET | BPF_K, 0, 0, ACCEPT});
+        }
+        program.push_back({BPF_RET | BPF_K, 0, 0, DROP});
+
+        if (BPF_MAXINSNS < program.size()) {
+            program.clear();
+        }
+    } catch (...) { // LCOV_EXCL_LINE
+        program.clear(); // LCOV_EXCL_LINE
+    }
+    return program;
+}
+#endif
+} // namespace
+
+struct OD4Session::StreamMonitor {
+    cluon::Histogram transportLatency{};
+    cluon::Histogram sampleAge{};
+    cluon::Histogram jitter{};
+    std::atomic<int64_t> firstReceived{0};
+    std::atomic<int64_t> lastReceived{0};
+    std::atomic<int64_t> lastInterArrivalTime{-1};
+
+    // Tracking of optional sequence numbers per sender.
+    struct SequenceTracker {
+        uint32_t highestSequenceNumber{0};
+        uint64_t window{0}; // Bit i is set if highestSequenceNumber - i was received.
+    };
+    std::mutex sequenceTrackersMutex{};
+    std::unordered_map<uint32_t, SequenceTracker, UseUInt32ValueAsHashKey> sequenceTrackers{};
+    uint64_t numberOfSequencedEnvelopes{0};
+    uint64_t numberOfLostEnvelopes{0};
+    uint64_t numberOfDuplicatedEnvelopes{0};
+    uint64_t numberOfReorderedEnvelopes{0};
+};
+
+class OD4Session::ConflatingDelegate {
+   private:
+    ConflatingDelegate(const ConflatingDelegate &) = delete;
+    ConflatingDelegate(ConflatingDelegate &&)      = delete;
+    ConflatingDelegate &operator=(const ConflatingDelegate &) = delete;
+    ConflatingDelegate &operator=(ConflatingDelegate &&) = delete;
+
+    struct Slot {
+        cluon::data::Envelope envelope{};
+        int64_t due{0}; // Time in microseconds when the slot is to be delivered.
+    };
+
+    // The state is shared with the delivering thread so that it outlives this
+    // object when the delegate unsets itself from within the delivering thread.
+    struct State {
+        std::function<void(cluon::data::Envelope &&envelope)> delegate{nullptr};
+        int64_t period{0};
+        std::mutex mutex{};
+        std::condition_variable condition{};
+        bool running{true};
+        std::unordered_map<uint32_t, Slot, UseUInt32ValueAsHashKey> slots{};
+        std::deque<uint32_t> pendingSenderStamps{};
+        std::atomic<uint64_t> numberOfConflatedEnvelopes{0};
+    };
+
+   public:
+    /**
+     * @param delegate Delegate to be called with the latest Envelope per senderStamp.
+     * @param period If > 0, the latest Envelope per senderStamp is delivered at the end of time windows of this length in microseconds.
+     */
+    ConflatingDelegate(std::function<void(cluon::data::Envelope &&envelope)> delegate, int64_t period) noexcept
+        : m_state{std::make_shared<State>()} {
+        m_state->delegate = std::move(delegate);
+        m_state->period   = period;
+        try {
+            std::shared_ptr<State> state{m_state};
+            m_deliveringThread = std::thread([state]() {
+                while (true) {
+                    cluon::data::Envelope env;
+                    {
+                        std::unique_lock<std::mutex> lck(state->mutex);
+                        state->condition.wait(lck, [&state]() { return !state->running || !state->pendingSenderStamps.empty(); });
+                        if (!state->running) {
+                            break;
+                        }
+                        // Slots become due in the order of their first pending Envelope.
+                        const uint32_t SENDER_STAMP{state->pendingSenderStamps.front()};
+                        const int64_t DUE{state->slots[SENDER_STAMP].due};
+                        if (cluon::time::toMicroseconds(cluon::time::now()) < DUE) {
+                            const std::chrono::system_clock::time_point DUE_TIMEPOINT{std::chrono::microseconds(DUE)};
+                            state->condition.wait_until(lck, DUE_TIMEPOINT, [&state]() { return !state->running; });
+                            continue;
+                        }
+                        state->pendingSenderStamps.pop_front();
+                        env = std::move(state->slots[SENDER_STAMP].envelope);
+                        state->slots.erase(SENDER_STAMP);
+                    }
+                    try {
+                        state->delegate(std::move(env));
+                    } catch (...) {} // LCOV_EXCL_LINE
+                }
+            });
+        } catch (...) {} // LCOV_EXCL_LINE
+    }
+
+    ~ConflatingDelegate() noexcept {
+        {
+            std::lock_guard<std::mutex> lck(m_state->mutex);
+            m_state->running = false;
+        }
+        m_state->condition.notify_all();
+        try {
+            if (m_deliveringThread.joinable()) {
+                if (m_deliveringThread.get_id() == std::this_thread::get_id()) {
+                    m_deliveringThread.detach();
+                } else {
+                    m_deliveringThread.join();
+                }
+            }
+        } catch (...) {} // LCOV_EXCL_LINE
+    }
+
+    void add(cluon::data::Envelope &&envelope) noexcept {
+        try {
+            {
+                std::lock_guard<std::mutex> lck(m_state->mutex);
+                const uint32_t SENDER_STAMP{envelope.senderStamp()};
+                auto slot = m_state->slots.find(SENDER_STAMP);
+                if (slot != m_state->slots.end()) {
+                    slot->second.envelope = std::move(envelope);
+                    m_state->numberOfConflatedEnvelopes++;
+                } else {
+                    Slot s;
+                    if (0 < m_state->period) {
+                        // Deliver at the end of the time window in which this Envelope was received.
+                        s.due = (cluon::time::toMicroseconds(envelope.received()) / m_state->period + 1) * m_state->period;
+                    }
+                    s.envelope = std::move(envelope);
+                    m_state->slots.emplace(SENDER_STAMP, std::move(s));
+                    m_state->pendingSenderStamps.push_back(SENDER_STAMP);
+                }
+            }
+            m_state->condition.notify_all();
+        } catch (...) {} // LCOV_EXCL_LINE
+    }
+
+    uint64_t numberOfConflatedEnvelopes() const noexcept {
+        return m_state->numberOfConflatedEnvelopes.load();
+    }
+
+   private:
+    std::shared_ptr<State> m_state;
+    std::thread m_deliveringThread{};
+};
+
 OD4Session::OD4Session(uint16_t CID, std::function<void(cluon::data::Envelope &&envelope)> delegate) noexcept
-    : m_receiver{nullptr}
-    , m_sender{"225.0.0." + std::to_string(CID), 12175}
+    : m_CID{CID}
+    , m_receiver{nullptr}
+    , m_sender{InProcessRegistry::instance().sender(CID)}
     , m_delegate(std::move(delegate))
     , m_mapOfDataTriggeredDelegatesMutex{}
     , m_mapOfDataTriggeredDelegates{} {
+    try {
+        std::random_device rd;
+        std::mt19937 generator(rd());
+        std::uniform_int_distribution<uint32_t> distribution(1, UINT32_MAX);
+        m_sourceIdentifier = distribution(generator);
+    } catch (...) {                                                                                          // LCOV_EXCL_LINE
+        m_sourceIdentifier = static_cast<uint32_t>(cluon::time::toMicroseconds(cluon::time::now())) | 1u; // LCOV_EXCL_LINE
+    }
+
     m_receiver = std::make_unique<cluon::UDPReceiver>(
         "225.0.0." + std::to_string(CID),
         12175,
         [this](std::string &&data, std::string &&from, std::chrono::system_clock::time_point &&timepoint) {
-            this->callback(std::move(data), std::move(from), std::move(timepoint));
+            this->callback(std::move(data), std::move(from), std::move(timepoint), false);
         },
-        m_sender.getSendFromPort() /* passing our local send from port to the UDPReceiver to filter out our own bytes */);
+        (m_sender ? m_sender->getSendFromPort() : 0) /* passing our process' local send from port to the UDPReceiver to filter out bytes sent from this process */);
+
+    try {
+        m_inProcessPipeline = std::make_shared<cluon::NotifyingPipeline<cluon::data::Envelope>>(
+            [this](cluon::data::Envelope &&envelope) { this->dispatch(std::move(envelope)); });
+        InProcessRegistry::instance().add(m_CID, m_inProcessPipeline);
+    } catch (...) {} // LCOV_EXCL_LINE
+
+    const char *CLUON_OD4SESSION_SHAREDMEMORY = getenv("CLUON_OD4SESSION_SHAREDMEMORY");
+    if ((nullptr != CLUON_OD4SESSION_SHAREDMEMORY) && (CLUON_OD4SESSION_SHAREDMEMORY[0] == '1')) {
+        enableSharedMemoryTransport();
+    }
+
+    const char *CLUON_OD4SESSION_PARTITIONS = getenv("CLUON_OD4SESSION_PARTITIONS");
+    if (nullptr != CLUON_OD4SESSION_PARTITIONS) {
+        const int32_t PARTITIONS{std::atoi(CLUON_OD4SESSION_PARTITIONS)};
+        if ((0 < PARTITIONS) && (PARTITIONS <= 255)) {
+            enableTopicPartitioning(static_cast<uint8_t>(PARTITIONS));
+        }
+    }
+
+    updateSubscriptions();
+}
+
+OD4Session::~OD4Session() noexcept {
+    m_monitorThreadRunning.store(false);
+    try {
+        if (m_monitorThread.joinable()) {
+            m_monitorThread.join();
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+
+    m_sharedMemoryRingActive.store(false);
+    m_sharedMemoryRingThreadRunning.store(false);
+    try {
+        if (m_sharedMemoryRingThread.joinable()) {
+            m_sharedMemoryRingThread.join();
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    if (m_sharedMemoryRing && m_sender) {
+        m_sharedMemoryRing->removeParticipant(m_sender->getSendFromPort());
+    }
+    m_sharedMemoryRing.reset();
+    m_sharedMemoryPoolActive.store(false);
+    m_attachedSharedMemoryPools.clear();
+    m_sharedMemoryPool.reset();
+
+    // Stop receiving Envelopes from other OD4Sessions in this process before tearing down.
+    if (m_inProcessPipeline) {
+        InProcessRegistry::instance().remove(m_CID, m_inProcessPipeline);
+    }
+    try {
+        std::lock_guard<std::mutex> lck{m_partitionReceiversMutex};
+        m_partitionReceivers.clear();
+    } catch (...) {} // LCOV_EXCL_LINE
+    m_receiver.reset();
+    m_inProcessPipeline.reset();
+
+    m_highPriorityPipeline.reset();
+    m_normalPriorityPipeline.reset();
+}
+
+bool OD4Session::enableSharedMemoryTransport(uint32_t numberOfSlots, uint32_t slotSize) noexcept {
+#ifdef WIN32
+    (void)numberOfSlots;
+    (void)slotSize;
+    return false;
+#else
+    try {
+        std::lock_guard<std::mutex> lck{m_sharedMemoryRingMutex};
+        if (!m_sharedMemoryRingActive.load() && m_sender && (0 < m_sender->getSendFromPort())) {
+            // Every Envelope that fits into a UDP datagram must fit into the ring as
+            // UDP datagrams from local participants are ignored.
+            constexpr uint32_t MAX_LENGTH = static_cast<uint32_t>(UDPPacketSizeConstraints::MAX_SIZE_UDP_PACKET);
+            m_sharedMemoryRing = std::make_unique<cluon::SharedMemoryRing>(
+                "/cluon-od4-" + std::to_string(m_CID), (0 < numberOfSlots ? numberOfSlots : 1), (slotSize < MAX_LENGTH ? MAX_LENGTH : slotSize));
+            if (m_sharedMemoryRing->valid() && (MAX_LENGTH <= m_sharedMemoryRing->slotSize())
+                && m_sharedMemoryRing->addParticipant(m_sender->getSendFromPort())) {
+                m_sharedMemoryRingThreadRunning.store(true);
+                m_sharedMemoryRingThread = std::thread(&OD4Session::readFromSharedMemoryRing, this);
+                m_sharedMemoryRingActive.store(true);
+            } else {
+                std::cerr << "[cluon::OD4Session]: Failed to enable shared memory transport for CID " << m_CID << "." << std::endl;
+                m_sharedMemoryRing.reset();
+            }
+        }
+    } catch (...) { // LCOV_EXCL_LINE
+        m_sharedMemoryRingThreadRunning.store(false); // LCOV_EXCL_LINE
+    }
+    return m_sharedMemoryRingActive.load();
+#endif
+}
+
+bool OD4Session::enableZeroCopyTransport(uint32_t threshold, uint32_t numberOfSlots, uint32_t slotSize, RemoteFallback fallback) noexcept {
+    if (!enableSharedMemoryTransport()) {
+        return false;
+    }
+    try {
+        std::lock_guard<std::mutex> lck{m_sharedMemoryPoolMutex};
+        if (!m_sharedMemoryPoolActive.load()) {
+            m_sharedMemoryPool = std::make_unique<cluon::SharedMemoryPool>(
+                nameOfSharedMemoryPool(m_CID, m_sourceIdentifier), (0 < numberOfSlots ? numberOfSlots : 1), slotSize);
+            if (m_sharedMemoryPool->valid()) {
+                m_zeroCopyThreshold = threshold;
+                m_remoteFallback    = fallback;
+                m_sharedMemoryPoolActive.store(true);
+            } else {
+                std::cerr << "[cluon::OD4Session]: Failed to enable zero-copy transport for CID " << m_CID << "." << std::endl;
+                m_sharedMemoryPool.reset();
+            }
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    return m_sharedMemoryPoolActive.load();
+}
+
+void OD4Session::readFromSharedMemoryRing() noexcept {
+#ifndef WIN32
+    const int32_t PID{static_cast<int32_t>(::getpid())};
+    std::string data;
+    while (m_sharedMemoryRingThreadRunning.load()) {
+        // Keep the own pool and the registrations with pools of local peers alive; pools of peers that have gone are released.
+        if (m_sharedMemoryPoolActive.load()) {
+            m_sharedMemoryPool->heartbeat();
+        }
+        for (auto it = m_attachedSharedMemoryPools.begin(); it != m_attachedSharedMemoryPools.end();) {
+            if (it->second->valid()) {
+                it->second->heartbeat();
+                it++;
+            } else {
+                it = m_attachedSharedMemoryPools.erase(it);
+            }
+        }
+
+        if (m_sharedMemoryRing->pop(data, std::chrono::milliseconds(100))) {
+            // Envelopes from OD4Sessions in this process are delivered in-process.
+            if (PID != m_sharedMemoryRing->producer()) {
+                uint32_t sequenceNumber{0};
+                uint32_t sourceIdentifier{0};
+                uint32_t numberOfPartitions{0};
+                uint64_t sharedMemoryReference{0};
+                auto retVal = extractEnvelope(data.data(), data.size(), sequenceNumber, sourceIdentifier, numberOfPartitions, sharedMemoryReference);
+                if (retVal.first) {
+                    cluon::data::Envelope env{retVal.second};
+                    env.received(cluon::time::now());
+                    if (0 != sharedMemoryReference) {
+                        dispatchFromSharedMemoryPool(std::move(env), sharedMemoryReference, sequenceNumber, sourceIdentifier);
+                    } else {
+                        dispatch(std::move(env), sequenceNumber, sourceIdentifier);
+                    }
+                }
+            }
+        }
+    }
+#endif
+}
+
+void OD4Session::dispatchFromSharedMemoryPool(cluon::data::Envelope &&env, uint64_t reference, uint32_t sequenceNumber, uint32_t sourceIdentifier) noexcept {
+    try {
+        auto &entry = m_attachedSharedMemoryPools[sourceIdentifier];
+        if (!entry) {
+            entry = std::make_unique<cluon::SharedMemoryPool>(nameOfSharedMemoryPool(m_CID, sourceIdentifier));
+        }
+        cluon::SharedMemoryPool *pool{entry.get()};
+        if (!pool->valid()) {
+            m_attachedSharedMemoryPools.erase(sourceIdentifier);
+            pool = nullptr;
+        }
+
+        bool accessed{false};
+        bool hasZeroCopyDelegate{false};
+        if (nullptr != pool) {
+            // Views on the payload are passed while holding the delegate mutex as for deliver().
+            std::lock_guard<std::mutex> lck{m_delegateMutex};
+            std::function<void(const cluon::data::Envelope &envelope, const char *data, uint32_t size)> *delegate{nullptr};
+            {
+                std::lock_guard<std::mutex> lck2{m_mapOfZeroCopyDelegatesMutex};
+                auto element = m_mapOfZeroCopyDelegates.find(env.dataType());
+                if (element != m_mapOfZeroCopyDelegates.end()) {
+                    delegate = &(element->second);
+                }
+            }
+            if (nullptr != delegate) {
+                hasZeroCopyDelegate = true;
+                accessed = pool->access(reference, [&env, &delegate](const char *data, uint32_t size) { (*delegate)(env, data, size); });
+                if (accessed && m_monitorEnabled.load()) {
+                    monitor(env, sequenceNumber, sourceIdentifier);
+                }
+            }
+        }
+
+        // All other delegates receive a copy of the payload in the Envelope.
+        if ((nullptr != pool) && !hasZeroCopyDelegate) {
+            accessed = pool->access(reference, [&env](const char *data, uint32_t size) { env.serializedData(std::string(data, size)); });
+            if (accessed) {
+                dispatch(std::move(env), sequenceNumber, sourceIdentifier);
+            }
+        }
+
+        if (!accessed) {
+            // The payload was reused or its pool has gone before it could be accessed.
+            if (0 == (m_numberOfLostSharedMemoryPayloads++ % 1000)) {
+                std::cerr << "[cluon::OD4Session]: Lost " << m_numberOfLostSharedMemoryPayloads << " payload(s) from shared memory pools for CID " << m_CID
+                          << "." << std::endl;
+            }
+            if (m_monitorEnabled.load()) {
+                monitor(env, sequenceNumber, sourceIdentifier, true);
+            }
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+}
+
+void OD4Session::enableSequenceNumbers() noexcept {
+    m_sequenceNumbersEnabled.store(true);
+}
+
+void OD4Session::enableMonitor(float freq) noexcept {
+    try {
+        std::lock_guard<std::mutex> lck{m_monitorMutex};
+        if (!m_monitorEnabled.exchange(true)) {
+            // The monitor needs to see all Envelopes.
+            updateSubscriptions();
+        }
+        if ((0.0f < freq) && !m_monitorThreadRunning.load()) {
+            const int64_t TIME_SLICE{static_cast<int64_t>(1000.0f * 1000.0f * (1.0f / (freq > 1000.0f ? 1000.0f : freq)))};
+            m_monitorThreadRunning.store(true);
+            m_monitorThread = std::thread([this, TIME_SLICE]() {
+                auto nextSummary{std::chrono::steady_clock::now() + std::chrono::microseconds(TIME_SLICE)};
+                while (m_monitorThreadRunning.load()) {
+                    if (std::chrono::steady_clock::now() < nextSummary) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                        continue;
+                    }
+                    nextSummary += std::chrono::microseconds(TIME_SLICE);
+                    for (auto &s : statistics()) { send(s); }
+                }
+            });
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+}
+
+std::vector<cluon::data::EnvelopeStatistics> OD4Session::statistics() noexcept {
+    std::vector<cluon::data::EnvelopeStatistics> listOfStatistics;
+    try {
+        std::lock_guard<std::mutex> lck{m_monitorMutex};
+        for (const auto &e : m_mapOfStreamMonitors) {
+            StreamMonitor &m{*(e.second)};
+            const uint64_t COUNT{m.transportLatency.count()};
+            const int64_t DURATION{m.lastReceived.load() - m.firstReceived.load()};
+
+            cluon::data::EnvelopeStatistics s;
+            s.dataType(static_cast<int32_t>(e.first >> 32))
+                .senderStamp(static_cast<uint32_t>(e.first & 0xFFFFFFFF))
+                .numberOfEnvelopes(COUNT)
+                .rate((1 < COUNT) && (0 < DURATION) ? static_cast<float>(static_cast<double>(COUNT - 1) * 1000.0 * 1000.0 / static_cast<double>(DURATION)) : 0.0f)
+                .transportLatencyP50(m.transportLatency.percentile(50.0))
+                .transportLatencyP99(m.transportLatency.percentile(99.0))
+                .transportLatencyMax(m.transportLatency.max())
+                .sampleAgeP50(m.sampleAge.percentile(50.0))
+                .sampleAgeP99(m.sampleAge.percentile(99.0))
+                .sampleAgeMax(m.sampleAge.max())
+                .jitterP50(m.jitter.percentile(50.0))
+                .jitterP99(m.jitter.percentile(99.0))
+                .jitterMax(m.jitter.max());
+            {
+                std::lock_guard<std::mutex> lck2{m.sequenceTrackersMutex};
+                const uint64_t EXPECTED{m.numberOfSequencedEnvelopes + m.numberOfLostEnvelopes};
+                s.numberOfLostEnvelopes(m.numberOfLostEnvelopes)
+                    .numberOfDuplicatedEnvelopes(m.numberOfDuplicatedEnvelopes)
+                    .numberOfReorderedEnvelopes(m.numberOfReorderedEnvelopes)
+                    .lossRate(0 < EXPECTED ? static_cast<float>(static_cast<double>(m.numberOfLostEnvelopes) / static_cast<double>(EXPECTED)) : 0.0f);
+            }
+            listOfStatistics.push_back(s);
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    return listOfStatistics;
+}
+
+void OD4Session::monitor(const cluon::data::Envelope &envelope, uint32_t sequenceNumber, uint32_t sourceIdentifier, bool isLost) noexcept {
+    try {
+        const uint64_t KEY{(static_cast<uint64_t>(static_cast<uint32_t>(envelope.dataType())) << 32) | envelope.senderStamp()};
+        StreamMonitor *m{nullptr};
+        {
+            std::lock_guard<std::mutex> lck{m_monitorMutex};
+            auto &entry = m_mapOfStreamMonitors[KEY];
+            if (!entry) {
+                entry = std::make_shared<StreamMonitor>();
+            }
+            m = entry.get();
+        }
+
+        // The histograms are lock-free as Envelopes for the same stream may arrive concurrently from different transports.
+        if (!isLost) {
+            const int64_t RECEIVED{cluon::time::toMicroseconds(envelope.received())};
+            m->transportLatency.record(RECEIVED - cluon::time::toMicroseconds(envelope.sent()));
+            m->sampleAge.record(RECEIVED - cluon::time::toMicroseconds(envelope.sampleTimeStamp()));
+
+            int64_t expected{0};
+            m->firstReceived.compare_exchange_strong(expected, RECEIVED);
+            const int64_t LAST_RECEIVED{m->lastReceived.exchange(RECEIVED)};
+            if (0 < LAST_RECEIVED) {
+                const int64_t INTER_ARRIVAL_TIME{RECEIVED - LAST_RECEIVED};
+                const int64_t LAST_INTER_ARRIVAL_TIME{m->lastInterArrivalTime.exchange(INTER_ARRIVAL_TIME)};
+                if (0 <= LAST_INTER_ARRIVAL_TIME) {
+                    m->jitter.record(std::abs(INTER_ARRIVAL_TIME - LAST_INTER_ARRIVAL_TIME));
+                }
+            }
+        }
+
+        if (0 != sequenceNumber) {
+            std::lock_guard<std::mutex> lck{m->sequenceTrackersMutex};
+            m->numberOfSequencedEnvelopes++;
+            bool isDuplicate{false};
+            auto entry = m->sequenceTrackers.find(sourceIdentifier);
+            if (entry == m->sequenceTrackers.end()) {
+                StreamMonitor::SequenceTracker t;
+                t.highestSequenceNumber = sequenceNumber;
+                t.window                = 1;
+                m->sequenceTrackers[sourceIdentifier] = t;
+            } else {
+                StreamMonitor::SequenceTracker &t{entry->second};
+                // The signed difference handles the wrap-around of sequence numbers.
+                const int32_t DELTA{static_cast<int32_t>(sequenceNumber - t.highestSequenceNumber)};
+                if (0 < DELTA) {
+                    m->numberOfLostEnvelopes += static_cast<uint64_t>(DELTA - 1);
+                    t.window                = ((DELTA < 64) ? (t.window << DELTA) : 0) | 1;
+                    t.highestSequenceNumber = sequenceNumber;
+                } else if ((DELTA > -64) && (0 != (t.window & (static_cast<uint64_t>(1) << -DELTA)))) {
+                    m->numberOfDuplicatedEnvelopes++;
+                    m->numberOfSequencedEnvelopes--;
+                    isDuplicate = true;
+                } else {
+                    // A late Envelope that was counted as lost before.
+                    if (DELTA > -64) {
+                        t.window |= (static_cast<uint64_t>(1) << -DELTA);
+                    }
+                    m->numberOfReorderedEnvelopes += (isLost ? 0 : 1);
+                    if (0 < m->numberOfLostEnvelopes) {
+                        m->numberOfLostEnvelopes--;
+                    }
+                }
+            }
+            // The sequence number of a lost Envelope is marked as seen to not count it twice.
+            if (isLost && !isDuplicate) {
+                m->numberOfSequencedEnvelopes--;
+                m->numberOfLostEnvelopes++;
+            }
+        } else if (isLost) {
+            std::lock_guard<std::mutex> lck{m->sequenceTrackersMutex};
+            m->numberOfLostEnvelopes++;
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
 }
 
 void OD4Session::timeTrigger(float freq, std::function<bool()> delegate) noexcept {
@@ -66,6 +762,10 @@ bool OD4Session::dataTrigger(int32_t messageIdentifier, std::function<void(cluon
     bool retVal{false};
     if (nullptr == m_delegate) {
         try {
+            // Wait for running delegates of all priority classes before replacing a delegate.
+            std::lock(m_delegateMutex, m_highPriorityDelegateMutex);
+            std::lock_guard<std::mutex> lckNormal{m_delegateMutex, std::adopt_lock};
+            std::lock_guard<std::mutex> lckHigh{m_highPriorityDelegateMutex, std::adopt_lock};
             std::lock_guard<std::mutex> lck{m_mapOfDataTriggeredDelegatesMutex};
             if ((nullptr == delegate) && (m_mapOfDataTriggeredDelegates.count(messageIdentifier) > 0)) {
                 auto element = m_mapOfDataTriggeredDelegates.find(messageIdentifier);
@@ -75,13 +775,236 @@ bool OD4Session::dataTrigger(int32_t messageIdentifier, std::function<void(cluon
             } else {
                 m_mapOfDataTriggeredDelegates[messageIdentifier] = delegate;
             }
+            // A previously set delegate for views on payloads is replaced.
+            {
+                std::lock_guard<std::mutex> lck2{m_mapOfZeroCopyDelegatesMutex};
+                m_mapOfZeroCopyDelegates.erase(messageIdentifier);
+            }
             retVal = true;
         } catch (...) {} // LCOV_EXCL_LINE
     }
+    if (retVal) {
+        updateSubscriptions();
+
+        // A previously set delegate for the latest Envelopes is replaced; stop it outside of the locks.
+        std::shared_ptr<ConflatingDelegate> previous;
+        try {
+            std::lock_guard<std::mutex> lck{m_mapOfConflatingDelegatesMutex};
+            auto element = m_mapOfConflatingDelegates.find(messageIdentifier);
+            if (element != m_mapOfConflatingDelegates.end()) {
+                previous = element->second;
+                m_mapOfConflatingDelegates.erase(element);
+            }
+        } catch (...) {} // LCOV_EXCL_LINE
+    }
     return retVal;
 }
 
-void OD4Session::callback(std::string &&data, std::string && /*from*/, std::chrono::system_clock::time_point &&timepoint) noexcept {
+bool OD4Session::dataTrigger(int32_t messageIdentifier,
+                             float freq,
+                             DecimationPolicy policy,
+                             std::function<void(cluon::data::Envelope &&envelope)> delegate) noexcept {
+    if ((nullptr == delegate) || !(0.0f < freq)) {
+        return dataTrigger(messageIdentifier, delegate);
+    }
+
+    const int64_t PERIOD{std::max<int64_t>(1, static_cast<int64_t>(1000.0 * 1000.0 / static_cast<double>(freq)))};
+    if (DecimationPolicy::LAST_IN_WINDOW == policy) {
+        return setConflatingDelegate(messageIdentifier, PERIOD, delegate);
+    }
+
+    bool retVal{false};
+    try {
+        // Time in microseconds per senderStamp from when on the next Envelope is to be delivered.
+        struct Decimation {
+            std::mutex mutex{};
+            std::unordered_map<uint32_t, int64_t, UseUInt32ValueAsHashKey> nextDelivery{};
+        };
+        auto decimation = std::make_shared<Decimation>();
+        retVal          = dataTrigger(messageIdentifier, [decimation, PERIOD, policy, delegate](cluon::data::Envelope &&envelope) {
+            const int64_t RECEIVED{cluon::time::toMicroseconds(envelope.received())};
+            bool deliver{false};
+            {
+                std::lock_guard<std::mutex> lck(decimation->mutex);
+                auto entry = decimation->nextDelivery.find(envelope.senderStamp());
+                if ((entry == decimation->nextDelivery.end()) || (RECEIVED >= entry->second)) {
+                    deliver = true;
+                    int64_t next{RECEIVED + PERIOD};
+                    if (DecimationPolicy::FIRST_IN_WINDOW == policy) {
+                        // Windows are aligned to multiples of the period.
+                        next = (RECEIVED / PERIOD + 1) * PERIOD;
+                    } else if ((entry != decimation->nextDelivery.end()) && (entry->second + PERIOD > RECEIVED)) {
+                        // Keep an even spacing unless the stream paused for longer than a period.
+                        next = entry->second + PERIOD;
+                    }
+                    decimation->nextDelivery[envelope.senderStamp()] = next;
+                }
+            }
+            if (deliver) {
+                delegate(std::move(envelope));
+            }
+        });
+    } catch (...) {} // LCOV_EXCL_LINE
+    return retVal;
+}
+
+bool OD4Session::dataTriggerLatest(int32_t messageIdentifier, std::function<void(cluon::data::Envelope &&envelope)> delegate) noexcept {
+    if (nullptr == delegate) {
+        return dataTrigger(messageIdentifier, nullptr);
+    }
+    return setConflatingDelegate(messageIdentifier, 0, delegate);
+}
+
+bool OD4Session::dataTriggerZeroCopy(int32_t messageIdentifier,
+                                     std::function<void(const cluon::data::Envelope &envelope, const char *data, uint32_t size)> delegate) noexcept {
+    if (nullptr == delegate) {
+        return dataTrigger(messageIdentifier, nullptr);
+    }
+
+    bool retVal{false};
+    try {
+        // Envelopes that carry their payload are passed with a view on their serializedData.
+        retVal = dataTrigger(messageIdentifier, [delegate](cluon::data::Envelope &&envelope) {
+            const std::string &payload{envelope.serializedData()};
+            delegate(envelope, payload.data(), static_cast<uint32_t>(payload.size()));
+        });
+        if (retVal) {
+            std::lock_guard<std::mutex> lck{m_mapOfZeroCopyDelegatesMutex};
+            m_mapOfZeroCopyDelegates[messageIdentifier] = delegate;
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    return retVal;
+}
+
+bool OD4Session::setConflatingDelegate(int32_t messageIdentifier, int64_t period, std::function<void(cluon::data::Envelope &&envelope)> delegate) noexcept {
+    bool retVal{false};
+    try {
+        auto conflatingDelegate = std::make_shared<ConflatingDelegate>(std::move(delegate), period);
+        retVal = dataTrigger(messageIdentifier, [conflatingDelegate](cluon::data::Envelope &&envelope) { conflatingDelegate->add(std::move(envelope)); });
+        if (retVal) {
+            std::lock_guard<std::mutex> lck{m_mapOfConflatingDelegatesMutex};
+            m_mapOfConflatingDelegates[messageIdentifier] = conflatingDelegate;
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    return retVal;
+}
+
+uint64_t OD4Session::numberOfConflatedEnvelopes(int32_t messageIdentifier) noexcept {
+    uint64_t retVal{0};
+    try {
+        std::lock_guard<std::mutex> lck{m_mapOfConflatingDelegatesMutex};
+        auto element = m_mapOfConflatingDelegates.find(messageIdentifier);
+        if (element != m_mapOfConflatingDelegates.end()) {
+            retVal = element->second->numberOfConflatedEnvelopes();
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    return retVal;
+}
+
+bool OD4Session::enableTopicPartitioning(uint8_t numberOfPartitions, bool sendToSingleGroup) noexcept {
+    if (0 == numberOfPartitions) {
+        return false;
+    }
+    uint8_t previous{0};
+    if (!m_numberOfPartitions.compare_exchange_strong(previous, numberOfPartitions)) {
+        return (previous == numberOfPartitions);
+    }
+    m_sendToSingleGroup.store(sendToSingleGroup);
+    updateSubscriptions();
+    return true;
+}
+
+std::string OD4Session::multicastGroup(uint16_t CID, int32_t dataType, uint8_t numberOfPartitions) noexcept {
+    std::string group;
+    try {
+        if (0 == numberOfPartitions) {
+            group = "225.0.0." + std::to_string(CID);
+        } else {
+            group = "225.1." + std::to_string(partitionOf(dataType, numberOfPartitions)) + "." + std::to_string(CID);
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    return group;
+}
+
+void OD4Session::updateSubscriptions() noexcept {
+    updatePartitions();
+    updateSocketFilter();
+}
+
+void OD4Session::updatePartitions() noexcept {
+    const uint8_t PARTITIONS{m_numberOfPartitions.load()};
+    if (0 == PARTITIONS) {
+        return;
+    }
+    try {
+        std::set<uint8_t> partitions;
+        if ((nullptr != m_delegate) || m_monitorEnabled.load()) {
+            for (uint16_t p{0}; p < PARTITIONS; p++) { partitions.insert(static_cast<uint8_t>(p)); }
+        } else {
+            std::lock_guard<std::mutex> lck{m_mapOfDataTriggeredDelegatesMutex};
+            for (const auto &e : m_mapOfDataTriggeredDelegates) { partitions.insert(partitionOf(e.first, PARTITIONS)); }
+        }
+
+        // Join only the multicast groups of the partitions with subscriptions.
+        std::lock_guard<std::mutex> lck{m_partitionReceiversMutex};
+        for (auto it = m_partitionReceivers.begin(); it != m_partitionReceivers.end();) {
+            it = (0 == partitions.count(it->first) ? m_partitionReceivers.erase(it) : std::next(it));
+        }
+        for (auto p : partitions) {
+            if (0 == m_partitionReceivers.count(p)) {
+                m_partitionReceivers[p] = std::make_unique<cluon::UDPReceiver>(
+                    "225.1." + std::to_string(p) + "." + std::to_string(m_CID),
+                    12175,
+                    [this](std::string &&data, std::string &&from, std::chrono::system_clock::time_point &&timepoint) {
+                        this->callback(std::move(data), std::move(from), std::move(timepoint), true);
+                    },
+                    (m_sender ? m_sender->getSendFromPort() : 0));
+            }
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+}
+
+void OD4Session::updateSocketFilter() noexcept {
+#ifdef __linux__
+    try {
+        // Serialize updates so that the most recent subscriptions are attached last.
+        std::lock_guard<std::mutex> lck{m_socketFilterMutex};
+        std::vector<int32_t> listOfDataTypes;
+        {
+            std::lock_guard<std::mutex> lck2{m_mapOfDataTriggeredDelegatesMutex};
+            for (const auto &e : m_mapOfDataTriggeredDelegates) { listOfDataTypes.push_back(e.first); }
+        }
+        std::vector<cluon::UDPReceiver::FilterInstruction> program;
+        if ((nullptr == m_delegate) && !m_monitorEnabled.load()) {
+            program = socketFilterFor(listOfDataTypes);
+        }
+        bool failed{false};
+        if (0 < m_numberOfPartitions.load()) {
+            std::lock_guard<std::mutex> lck2{m_partitionReceiversMutex};
+            for (auto &e : m_partitionReceivers) { failed |= (e.second->isRunning() && !e.second->setSocketFilter(program)); }
+            // All Envelopes on the single group are needed to detect single-group peers.
+            program.clear();
+        }
+        failed |= (m_receiver && m_receiver->isRunning() && !m_receiver->setSocketFilter(program));
+        if (failed) {
+            std::cerr << "[cluon::OD4Session]: Failed to update socket filter for CID " << m_CID << "." << std::endl;
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+#endif
+}
+
+void OD4Session::callback(std::string &&data, std::string &&from, std::chrono::system_clock::time_point &&timepoint, bool isFromPartitionGroup) noexcept {
+    if (m_sharedMemoryRingActive.load()) {
+        // Ignore UDP multicast copies of Envelopes that local peers have placed in the shared memory ring.
+        const auto POS{from.find_last_of(':')};
+        if (std::string::npos != POS) {
+            const uint16_t PORT{static_cast<uint16_t>(std::atoi(from.c_str() + POS + 1))};
+            if (m_sharedMemoryRing->isParticipant(PORT) && isLocalAddress(from.substr(0, POS))) {
+                return;
+            }
+        }
+    }
+
     size_t numberOfDataTriggeredDelegates{0};
     {
         try {
@@ -89,37 +1012,182 @@ void OD4Session::callback(std::string &&data, std::string && /*from*/, std::chro
             numberOfDataTriggeredDelegates = m_mapOfDataTriggeredDelegates.size();
         } catch (...) {} // LCOV_EXCL_LINE
     }
+    // With topic partitioning, Envelopes on the single group are inspected to detect single-group peers.
+    const uint8_t PARTITIONS{m_numberOfPartitions.load()};
+    const bool IS_FROM_SINGLE_GROUP{(0 < PARTITIONS) && !isFromPartitionGroup};
+
     // Only unpack the envelope when it needs to be post-processed.
-    if ((nullptr != m_delegate) || (0 < numberOfDataTriggeredDelegates)) {
-        std::stringstream sstr(data);
-        auto retVal = extractEnvelope(sstr);
+    if ((nullptr != m_delegate) || (0 < numberOfDataTriggeredDelegates) || m_monitorEnabled.load() || IS_FROM_SINGLE_GROUP) {
+        uint32_t sequenceNumber{0};
+        uint32_t sourceIdentifier{0};
+        uint32_t numberOfPartitions{0};
+        uint64_t sharedMemoryReference{0};
+        auto retVal = extractEnvelope(data.data(), data.size(), sequenceNumber, sourceIdentifier, numberOfPartitions, sharedMemoryReference);
 
         if (retVal.first) {
+            if (IS_FROM_SINGLE_GROUP) {
+                if (PARTITIONS == numberOfPartitions) {
+                    // Copy of an Envelope from a partitioned peer that is received via its partition group.
+                    return;
+                }
+                m_lastSingleGroupPeer.store(cluon::time::toMicroseconds(cluon::time::now()));
+            }
             cluon::data::Envelope env{retVal.second};
             env.received(cluon::time::convert(timepoint));
+            dispatch(std::move(env), sequenceNumber, sourceIdentifier);
+        }
+    }
+}
 
+void OD4Session::dispatch(cluon::data::Envelope &&env, uint32_t sequenceNumber, uint32_t sourceIdentifier) noexcept {
+    if (m_monitorEnabled.load()) {
+        monitor(env, sequenceNumber, sourceIdentifier);
+    }
+
+    if (m_priorityClassesEnabled.load()) {
+        try {
+            bool isHighPriority{false};
+            {
+                std::lock_guard<std::mutex> lck{m_mapOfPrioritiesMutex};
+                auto element   = m_mapOfPriorities.find(env.dataType());
+                isHighPriority = (element != m_mapOfPriorities.end()) && (Priority::HIGH == element->second.first);
+            }
+            auto &pipeline = (isHighPriority ? m_highPriorityPipeline : m_normalPriorityPipeline);
+            pipeline->add(std::move(env));
+            pipeline->notifyAll();
+        } catch (...) {} // LCOV_EXCL_LINE
+    } else {
+        deliver(std::move(env), false);
+    }
+}
+
+void OD4Session::deliver(cluon::data::Envelope &&env, bool isHighPriority) noexcept {
+    // Envelopes arrive from the network and from in-process OD4Sessions
+    // concurrently; thus, serialize calls to the user-supplied delegates
+    // per priority class.
+    try {
+        std::lock_guard<std::mutex> lck{isHighPriority ? m_highPriorityDelegateMutex : m_delegateMutex};
+        if (nullptr != m_delegate) {
             // "Catch all"-delegate.
-            if (nullptr != m_delegate) {
-                m_delegate(std::move(env));
-            } else {
-                try {
-                    // Data triggered-delegates.
-                    std::lock_guard<std::mutex> lck{m_mapOfDataTriggeredDelegatesMutex};
-                    if (m_mapOfDataTriggeredDelegates.count(env.dataType()) > 0) {
-                        m_mapOfDataTriggeredDelegates[env.dataType()](std::move(env));
-                    }
-                } catch (...) {} // LCOV_EXCL_LINE
+            m_delegate(std::move(env));
+        } else {
+            // Data triggered-delegates; they are not replaced while a delegate mutex is held.
+            std::function<void(cluon::data::Envelope &&envelope)> *delegate{nullptr};
+            {
+                std::lock_guard<std::mutex> lck2{m_mapOfDataTriggeredDelegatesMutex};
+                auto element = m_mapOfDataTriggeredDelegates.find(env.dataType());
+                if (element != m_mapOfDataTriggeredDelegates.end()) {
+                    delegate = &(element->second);
+                }
+            }
+            if (nullptr != delegate) {
+                (*delegate)(std::move(env));
             }
         }
+    } catch (...) {} // LCOV_EXCL_LINE
+}
+
+bool OD4Session::setPriority(int32_t messageIdentifier, Priority priority, uint8_t dscp) noexcept {
+    bool retVal{false};
+    if (63 < dscp) {
+        return retVal;
     }
+    try {
+        std::lock_guard<std::mutex> lck{m_mapOfPrioritiesMutex};
+        if (!m_priorityClassesEnabled.load()) {
+            m_highPriorityPipeline = std::make_shared<cluon::NotifyingPipeline<cluon::data::Envelope>>(
+                [this](cluon::data::Envelope &&envelope) { this->deliver(std::move(envelope), true); });
+            m_normalPriorityPipeline = std::make_shared<cluon::NotifyingPipeline<cluon::data::Envelope>>(
+                [this](cluon::data::Envelope &&envelope) { this->deliver(std::move(envelope), false); });
+            m_priorityClassesEnabled.store(true);
+        }
+        m_mapOfPriorities[messageIdentifier] = std::make_pair(priority, dscp);
+        retVal                               = true;
+    } catch (...) {} // LCOV_EXCL_LINE
+    return retVal;
 }
 
 void OD4Session::send(cluon::data::Envelope &&envelope) noexcept {
-    sendInternal(cluon::serializeEnvelope(std::move(envelope)));
+    sendInProcess(envelope);
+
+    uint32_t sequenceNumber{0};
+    if (m_sequenceNumbersEnabled.load()) {
+        try {
+            std::lock_guard<std::mutex> lck{m_sequenceNumbersMutex};
+            const uint64_t KEY{(static_cast<uint64_t>(static_cast<uint32_t>(envelope.dataType())) << 32) | envelope.senderStamp()};
+            sequenceNumber = ++m_sequenceNumbers[KEY];
+            if (0 == sequenceNumber) {
+                // 0 denotes an Envelope without sequence number.
+                sequenceNumber = ++m_sequenceNumbers[KEY];
+            }
+        } catch (...) {} // LCOV_EXCL_LINE
+    }
+
+    uint8_t dscp{0};
+    if (m_priorityClassesEnabled.load()) {
+        try {
+            std::lock_guard<std::mutex> lck{m_mapOfPrioritiesMutex};
+            auto element = m_mapOfPriorities.find(envelope.dataType());
+            if (element != m_mapOfPriorities.end()) {
+                dscp = element->second.second;
+            }
+        } catch (...) {} // LCOV_EXCL_LINE
+    }
+
+    const int32_t DATATYPE{envelope.dataType()};
+    const uint8_t PARTITIONS{m_numberOfPartitions.load()};
+
+    uint64_t sharedMemoryReference{0};
+    if (m_sharedMemoryPoolActive.load() && (m_zeroCopyThreshold <= envelope.serializedData().size())) {
+        try {
+            std::lock_guard<std::mutex> lck{m_sharedMemoryPoolMutex};
+            sharedMemoryReference = m_sharedMemoryPool->store(envelope.serializedData());
+        } catch (...) {} // LCOV_EXCL_LINE
+    }
+
+    if (0 != sharedMemoryReference) {
+        // Local peers receive the Envelope without payload but with a reference to it.
+        cluon::data::Envelope reference;
+        reference.dataType(envelope.dataType())
+            .sent(envelope.sent())
+            .received(envelope.received())
+            .sampleTimeStamp(envelope.sampleTimeStamp())
+            .senderStamp(envelope.senderStamp());
+        m_sharedMemoryRing->push(cluon::serializeEnvelope(std::move(reference), sequenceNumber, m_sourceIdentifier, PARTITIONS, sharedMemoryReference));
+        if (RemoteFallback::DROP == m_remoteFallback) {
+            return;
+        }
+    }
+    std::string dataToSend{cluon::serializeEnvelope(std::move(envelope), sequenceNumber, m_sourceIdentifier, PARTITIONS)};
+    if ((0 == sharedMemoryReference) && m_sharedMemoryRingActive.load()) {
+        m_sharedMemoryRing->push(dataToSend);
+    }
+    if (0 < PARTITIONS) {
+        // Copies for single-group peers are marked with the number of partitions so that partitioned peers ignore them.
+        if (m_sendToSingleGroup.load()
+            || (cluon::time::toMicroseconds(cluon::time::now()) - m_lastSingleGroupPeer.load() < SINGLE_GROUP_PEER_TIMEOUT)) {
+            sendInternal(std::string(dataToSend), dscp);
+        }
+        if (m_sender) {
+            m_sender->sendTo(std::move(dataToSend), multicastGroup(m_CID, DATATYPE, PARTITIONS), 12175, dscp);
+        }
+    } else {
+        sendInternal(std::move(dataToSend), dscp);
+    }
 }
 
-void OD4Session::sendInternal(std::string &&dataToSend) noexcept {
-    m_sender.send(std::move(dataToSend));
+void OD4Session::sendInProcess(const cluon::data::Envelope &envelope) noexcept {
+    if (m_inProcessPipeline) {
+        cluon::data::Envelope env{envelope};
+        env.received(cluon::time::now());
+        InProcessRegistry::instance().send(m_CID, m_inProcessPipeline, env);
+    }
+}
+
+void OD4Session::sendInternal(std::string &&dataToSend, uint8_t dscp) noexcept {
+    if (m_sender) {
+        m_sender->send(std::move(dataToSend), dscp);
+    }
 }
 
 bool OD4Session::isRunning() noexcept {
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "cluon/ProtoSizeVisitor.hpp"
+#include "cluon/VarInt.hpp"
+
+namespace cluon {
+
+std::size_t ProtoSizeVisitor::size() const noexcept {
+    return m_size;
+}
+
+std::size_t ProtoSizeVisitor::varIntSize(uint64_t v) noexcept {
+    return cluon::varint::size(v);
+}
+
+std::size_t ProtoSizeVisitor::keySize(uint32_t fieldIdentifier, uint8_t protoType) noexcept {
+    // Same key as in ToProtoVisitor::encodeKey.
+    return varIntSize((fieldIdentifier << 0x3) | protoType);
+}
+
+void ProtoSizeVisitor::preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+    (void)id;
+    (void)shortName;
+    (void)longName;
+}
+
+void ProtoSizeVisitor::postVisit() noexcept {}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
+    (void)typeName;
+    (void)name;
+    (void)v;
+    m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::VARINT)) + 1;
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
+    (void)typeName;
+    (void)name;
+    m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::VARINT)) + varIntSize(static_cast<uint8_t>(v));
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    const uint8_t ZIGZAG{static_cast<uint8_t>((v << 1) ^ (v >> ((sizeof(v) * 8) - 1)))};
+    m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::VARINT)) + varIntSize(ZIGZAG);
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::VARINT)) + varIntSize(v);
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    const uint16_t ZIGZAG{static_cast<uint16_t>((v << 1) ^ (v >> ((sizeof(v) * 8) - 1)))};
+    m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::VARINT)) + varIntSize(ZIGZAG);
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::VARINT)) + varIntSize(v);
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    const uint32_t ZIGZAG{static_cast<uint32_t>((v << 1) ^ (v >> ((sizeof(v) * 8) - 1)))};
+    m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::VARINT)) + varIntSize(ZIGZAG);
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::VARINT)) + varIntSize(v);
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    const uint64_t ZIGZAG{static_cast<uint64_t>((v << 1) ^ (v >> ((sizeof(v) * 8) - 1)))};
+    m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::VARINT)) + varIntSize(ZIGZAG);
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::VARINT)) + varIntSize(v);
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
+    (void)typeName;
+    (void)name;
+    (void)v;
+    m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::FOUR_BYTES)) + sizeof(uint32_t);
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
+    (void)typeName;
+    (void)name;
+    (void)v;
+    m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::EIGHT_BYTES)) + sizeof(uint64_t);
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
+    (void)typeName;
+    (void)name;
+    m_size += keySize(id, static_cast<uint8_t>(ProtoConstants::LENGTH_DELIMITED)) + varIntSize(v.size()) + v.size();
+}
+
+} // namespace cluon
@@ -7,13 +7,16 @@
  */
 
 #include "cluon/SharedMemory.hpp"
+#include "cluon/Time.hpp"
 
 // clang-format off
 #ifdef WIN32
     #include <limits>
+    #include <process.h>
 #else
     #include <cstdlib>
     #include <fcntl.h>
+    #include <signal.h>
     #include <sys/ipc.h>
     #include <sys/mman.h>
     #include <sys/sem.h>
@@ -22,13 +25,20 @@
     #include <sys/time.h>
     #include <sys/types.h>
     #include <unistd.h>
+    #ifdef __linux__
+        #include <linux/futex.h>
+        #include <sys/syscall.h>
+    #endif
 #endif
 // clang-format on
 
+#include <algorithm>
 #include <cerrno>
+#include <climits>
 #include <cstring>
 #include <iostream>
 #include <fstream>
+#include <thread>
 
 #if !defined(__APPLE__) && !defined(__OpenBSD__) && (defined(_SEM_SEMUN_UNDEFINED) || !defined(__FreeBSD__))
 union semun {
@@ -40,9 +50,70 @@ union semun {
 
 namespace cluon {
 
-SharedMemory::SharedMemory(const std::string &name, uint32_t size) noexcept
-    : m_size(size) {
-    if (!name.empty()) {
+namespace {
+constexpr uint64_t CACHE_LINE{64};
+constexpr uint64_t PAGE_SIZE{4096};
+#ifndef WIN32
+constexpr uint64_t HUGE_PAGE_SIZE{2 * 1024 * 1024};
+#endif
+
+uint32_t processIdentifier() noexcept {
+#ifdef WIN32
+    return static_cast<uint32_t>(::_getpid());
+#else
+    return static_cast<uint32_t>(::getpid());
+#endif
+}
+
+bool isProcessTerminated(uint32_t processID) noexcept {
+#ifdef WIN32
+    (void)processID;
+    return false;
+#else
+    return ((-1 == ::kill(static_cast<pid_t>(processID), 0)) && (ESRCH == errno));
+#endif
+}
+} // namespace
+
+constexpr uint32_t SharedMemory::MAX_NUMBER_OF_READERS;
+constexpr int64_t SharedMemory::READER_TIMEOUT;
+
+// Every slot is preceded by a header; sequence is odd while being written
+// and 2*(index+1) once the slot for the given index is published.
+struct SharedMemory::SlotHeader {
+    std::atomic<uint64_t> __sequence;
+    uint32_t __length;
+    int32_t __seconds;
+    int32_t __microseconds;
+};
+
+SharedMemory::SharedMemory(const std::string &name, uint32_t size, uint32_t numberOfSlots) noexcept
+    : SharedMemory(name, size, numberOfSlots, Options()) {}
+
+SharedMemory::SharedMemory(const std::string &name, uint32_t size, uint32_t numberOfSlots, const Options &options) noexcept
+    : m_size(size)
+    , m_options(options) {
+    // Mapped memory starts at a page boundary; thus, larger alignments cannot be guaranteed.
+    if ((0 == m_options.alignment) || (0 != (m_options.alignment & (m_options.alignment - 1))) || (PAGE_SIZE < m_options.alignment)) {
+        std::cerr << "[cluon::SharedMemory] Alignment " << m_options.alignment << " is not a power of two up to " << PAGE_SIZE << "; using " << CACHE_LINE << "." << std::endl;
+        m_options.alignment = static_cast<uint32_t>(CACHE_LINE);
+    }
+
+    if ((0 < size) && (0 < numberOfSlots)) {
+        // Every slot starts at a cache line.
+        const uint64_t STRIDE{((sizeof(SlotHeader) + size + CACHE_LINE - 1) / CACHE_LINE) * CACHE_LINE};
+        if (STRIDE * numberOfSlots < UINT32_MAX) {
+            m_numberOfSlots = numberOfSlots;
+            m_slotSize      = size;
+            m_slotStride    = static_cast<uint32_t>(STRIDE);
+            m_size          = static_cast<uint32_t>(STRIDE * numberOfSlots);
+        } else {
+            std::cerr << "[cluon::SharedMemory] " << numberOfSlots << " slots of " << size << " bytes exceed the maximum size of a shared memory area." << std::endl;
+            m_broken.store(true);
+        }
+    }
+
+    if (!name.empty() && !m_broken.load()) {
 #ifdef WIN32
         constexpr int MAX_LENGTH_NAME{MAX_PATH};
 #else
@@ -62,14 +133,9 @@ SharedMemory::SharedMemory(const std::string &name, uint32_t size) noexcept
         m_usePOSIX                           = ((nullptr != CLUON_SHAREDMEMORY_POSIX) && (CLUON_SHAREDMEMORY_POSIX[0] == '1'));
         std::clog << "[cluon::SharedMemory] Using " << (m_usePOSIX ? "POSIX" : "SysV") << " implementation." << std::endl;
 #endif
-        // Define filename for timestamping.
-        if (0 != n.find("/tmp")) {
-            m_nameForTimeStamping = "/tmp" + m_name;
-
-            // For NetBSD and OpenBSD or for the SysV-based implementation, we put all token files to /tmp.
-            if (!m_usePOSIX) {
-                m_name = m_nameForTimeStamping;
-            }
+        // For NetBSD and OpenBSD or for the SysV-based implementation, we put all token files to /tmp.
+        if ((0 != n.find("/tmp")) && !m_usePOSIX) {
+            m_name = "/tmp" + m_name;
         }
 #endif
 
@@ -81,14 +147,6 @@ SharedMemory::SharedMemory(const std::string &name, uint32_t size) noexcept
             }
         }
 
-        // Name of the file for timestamping.
-        {
-            m_nameForTimeStamping += n;
-            if (m_nameForTimeStamping.size() > MAX_LENGTH_NAME) {
-                m_nameForTimeStamping = m_nameForTimeStamping.substr(0, MAX_LENGTH_NAME);
-            }
-        }
-
 #ifdef WIN32
         initWIN32();
 #else
@@ -98,13 +156,64 @@ SharedMemory::SharedMemory(const std::string &name, uint32_t size) noexcept
             initSysV();
         }
 #endif
+        initSharedMemoryControl();
+    }
+}
+
+uint32_t SharedMemory::dataOffsetAfter(std::size_t headerSize) const noexcept {
+    return static_cast<uint32_t>(((headerSize + m_options.alignment - 1) / m_options.alignment) * m_options.alignment);
+}
+
+void SharedMemory::initSharedMemoryControl() noexcept {
+    if ((nullptr != m_sharedMemoryControl) && valid()) {
+        if (!m_hasOnlyAttachedToSharedMemory) {
+            m_sharedMemoryControl->__sequence.store(0);
+            m_sharedMemoryControl->__numberOfSlots = m_numberOfSlots;
+            m_sharedMemoryControl->__slotSize      = m_slotSize;
+            m_sharedMemoryControl->__writeIndex.store(0);
+            m_sharedMemoryControl->__generation.store(0);
+            m_sharedMemoryControl->__seconds.store(0);
+            m_sharedMemoryControl->__microseconds.store(0);
+            m_sharedMemoryControl->__frameCounter.store(0);
+#ifdef __linux__
+            m_useFutex = m_options.futex;
+#endif
+            m_sharedMemoryControl->__useFutex = (m_useFutex ? 1 : 0);
+            m_sharedMemoryControl->__futexWaiters.store(0);
+            for (auto &r : m_sharedMemoryControl->__readers) {
+                r.__processID.store(0);
+                r.__cursor.store(0);
+                r.__missedFrames.store(0);
+                r.__heartbeat.store(0);
+            }
+        } else if (0 < m_sharedMemoryControl->__numberOfSlots) {
+            // Use the layout of the existing slots.
+            const uint32_t SLOT_SIZE{m_sharedMemoryControl->__slotSize};
+            const uint64_t STRIDE{((sizeof(SlotHeader) + SLOT_SIZE + CACHE_LINE - 1) / CACHE_LINE) * CACHE_LINE};
+            if (STRIDE * m_sharedMemoryControl->__numberOfSlots <= m_size) {
+                m_numberOfSlots = m_sharedMemoryControl->__numberOfSlots;
+                m_slotSize      = SLOT_SIZE;
+                m_slotStride    = static_cast<uint32_t>(STRIDE);
+            }
+            // New consumers start with the next slot to be written.
+            m_readCursor = m_sharedMemoryControl->__writeIndex.load();
+        }
+        if (m_hasOnlyAttachedToSharedMemory) {
+            m_useFutex = (1 == m_sharedMemoryControl->__useFutex);
+        }
     }
 }
 
 SharedMemory::~SharedMemory() noexcept {
+    unregisterReader();
 #ifdef WIN32
     deinitWIN32();
 #else
+    if (m_useFutex && !m_hasOnlyAttachedToSharedMemory) {
+        // Wake any waiting threads as we are going to end the shared memory session.
+        m_sharedMemoryControl->__generation.fetch_add(1);
+        notifyAllFutex();
+    }
     if (m_usePOSIX) {
         deinitPOSIX();
     } else {
@@ -147,7 +256,9 @@ void SharedMemory::wait() noexcept {
 #ifdef WIN32
     waitWIN32();
 #else
-    if (m_usePOSIX) {
+    if (m_useFutex) {
+        waitUntilFutex(m_sharedMemoryControl->__generation.load(), std::chrono::steady_clock::time_point::max());
+    } else if (m_usePOSIX) {
         waitPOSIX();
     } else {
         waitSysV();
@@ -155,11 +266,40 @@ void SharedMemory::wait() noexcept {
 #endif
 }
 
+bool SharedMemory::waitFor(const std::chrono::microseconds &timeout) noexcept {
+    return waitUntil(std::chrono::steady_clock::now() + timeout);
+}
+
+bool SharedMemory::waitUntil(const std::chrono::steady_clock::time_point &deadline) noexcept {
+    bool retVal{false};
+    if (nullptr != m_sharedMemoryControl) {
+        const uint32_t GENERATION{m_sharedMemoryControl->__generation.load()};
+#ifdef WIN32
+        waitUntilWIN32(GENERATION, deadline);
+#else
+        if (m_useFutex) {
+            waitUntilFutex(GENERATION, deadline);
+        } else if (m_usePOSIX) {
+            waitUntilPOSIX(GENERATION, deadline);
+        } else {
+            waitUntilSysV(GENERATION, deadline);
+        }
+#endif
+        retVal = (GENERATION != m_sharedMemoryControl->__generation.load());
+    }
+    return retVal;
+}
+
 void SharedMemory::notifyAll() noexcept {
+    if (nullptr != m_sharedMemoryControl) {
+        m_sharedMemoryControl->__generation.fetch_add(1);
+    }
 #ifdef WIN32
     notifyAllWIN32();
 #else
-    if (m_usePOSIX) {
+    if (m_useFutex) {
+        notifyAllFutex();
+    } else if (m_usePOSIX) {
         notifyAllPOSIX();
     } else {
         notifyAllSysV();
@@ -169,69 +309,36 @@ void SharedMemory::notifyAll() noexcept {
 
 bool SharedMemory::setTimeStamp(const cluon::data::TimeStamp &ts) noexcept {
     bool retVal{false};
-
-#ifdef WIN32
-    (void)ts;
-#else
-    if ((retVal = isLocked())) {
-#ifdef __APPLE__
-        struct timeval accessedTime;
-        accessedTime.tv_sec = 0;
-        accessedTime.tv_usec = 0;
-
-        struct timeval modifiedTime;
-        modifiedTime.tv_sec = ts.seconds();
-        modifiedTime.tv_usec = ts.microseconds();
-
-        struct timeval times[2]{accessedTime, modifiedTime};
-        if (0 != futimes(m_fdForTimeStamping, times)) {
-            std::cerr << "[cluon::SharedMemory] Failed to set time stamp: '" << strerror(errno) << "' (" << errno << "): " << std::endl;
-            retVal = false;
-        }
-#else
-        struct timespec accessedTime;
-        accessedTime.tv_sec = 0;
-        accessedTime.tv_nsec = UTIME_OMIT;
-
-        struct timespec modifiedTime;
-        modifiedTime.tv_sec = ts.seconds();
-        modifiedTime.tv_nsec = ts.microseconds()*1000;
-
-        struct timespec times[2]{accessedTime, modifiedTime};
-        if (0 != futimens(m_fdForTimeStamping, times)) {
-            std::cerr << "[cluon::SharedMemory] Failed to set time stamp: '" << strerror(errno) << "' (" << errno << "): " << std::endl; // LCOV_EXCL_LINE
-            retVal = false; // LCOV_EXCL_LINE
-        }
-#endif
+    if ((retVal = (isLocked() && (nullptr != m_sharedMemoryControl)))) {
+        m_sharedMemoryControl->__seconds.store(ts.seconds(), std::memory_order_relaxed);
+        m_sharedMemoryControl->__microseconds.store(ts.microseconds(), std::memory_order_relaxed);
+        m_sharedMemoryControl->__frameCounter.fetch_add(1, std::memory_order_release);
     }
-#endif
-
     return retVal;
 }
 
 std::pair<bool, cluon::data::TimeStamp> SharedMemory::getTimeStamp() noexcept {
     bool retVal{false};
     cluon::data::TimeStamp sampleTimeStamp;
-
-#ifndef WIN32
     if ((retVal = isLocked())) {
-        struct stat fileStatus;
-        auto r = fstat(m_fdForTimeStamping, &fileStatus);
-        if (0 == r) {
-#ifdef __APPLE__
-            sampleTimeStamp.seconds(static_cast<int32_t>(fileStatus.st_mtimespec.tv_sec))
-                           .microseconds(static_cast<int32_t>(fileStatus.st_mtimespec.tv_nsec/1000));
-#else
-            sampleTimeStamp.seconds(static_cast<int32_t>(fileStatus.st_mtim.tv_sec))
-                           .microseconds(static_cast<int32_t>(fileStatus.st_mtim.tv_nsec/1000));
-#endif
-        }
+        sampleTimeStamp = this->sampleTimeStamp();
     }
-#endif
-
     return std::make_pair(retVal, sampleTimeStamp);
 }
 
+cluon::data::TimeStamp SharedMemory::sampleTimeStamp() const noexcept {
+    cluon::data::TimeStamp sampleTimeStamp;
+    if (nullptr != m_sharedMemoryControl) {
+        sampleTimeStamp.seconds(m_sharedMemoryControl->__seconds.load(std::memory_order_relaxed))
+            .microseconds(m_sharedMemoryControl->__microseconds.load(std::memory_order_relaxed));
+    }
+    return sampleTimeStamp;
+}
+
+uint64_t SharedMemory::frameCounter() const noexcept {
+    return (nullptr != m_sharedMemoryControl) ? m_sharedMemoryControl->__frameCounter.load(std::memory_order_acquire) : 0;
+}
+
 bool SharedMemory::valid() noexcept {
     bool valid{!m_broken.load()};
     valid &= (nullptr != m_sharedMemory);
@@ -258,6 +365,231 @@ const std::string SharedMemory::name() const noexcept {
     return m_name;
 }
 
+void SharedMemory::removeOnDestruction(bool remove) noexcept {
+    m_hasOnlyAttachedToSharedMemory = !remove;
+}
+
+void SharedMemory::beginWrite() noexcept {
+    if (nullptr != m_sharedMemoryControl) {
+        m_sharedMemoryControl->__sequence.fetch_add(1, std::memory_order_relaxed);
+        // Make the odd sequence counter visible before any modification of the data.
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+}
+
+void SharedMemory::endWrite() noexcept {
+    if (nullptr != m_sharedMemoryControl) {
+        m_sharedMemoryControl->__sequence.fetch_add(1, std::memory_order_release);
+    }
+}
+
+bool SharedMemory::read(std::function<void(const char *data, uint32_t size)> delegate, uint32_t maxNumberOfRetries) noexcept {
+    bool retVal{false};
+    if ((nullptr != delegate) && (nullptr != m_sharedMemoryControl) && valid()) {
+        for (uint32_t i{0}; !retVal && (i <= maxNumberOfRetries); i++) {
+            const uint32_t BEFORE{m_sharedMemoryControl->__sequence.load(std::memory_order_acquire)};
+            if (0 != (BEFORE % 2)) {
+                // A writer is modifying the data.
+                std::this_thread::yield();
+                continue;
+            }
+            const uint64_t FRAME_COUNTER{m_sharedMemoryControl->__frameCounter.load(std::memory_order_relaxed)};
+            try {
+                delegate(m_userAccessibleSharedMemory, m_size);
+            } catch (...) {} // LCOV_EXCL_LINE
+            // Make sure that the data was read before re-reading the sequence counter.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            retVal = (BEFORE == m_sharedMemoryControl->__sequence.load(std::memory_order_relaxed));
+            if (retVal && (0 <= m_readerIndex)) {
+                // All frames between the last read one and the current one were missed.
+                const uint64_t CONSUMED{(FRAME_COUNTER > m_readCursor) ? FRAME_COUNTER - m_readCursor : 0};
+                m_readCursor = std::max(m_readCursor, FRAME_COUNTER);
+                updateReader(m_readCursor, (0 < CONSUMED) ? CONSUMED - 1 : 0);
+            }
+        }
+    }
+    return retVal;
+}
+
+uint32_t SharedMemory::sequence() const noexcept {
+    return (nullptr != m_sharedMemoryControl) ? m_sharedMemoryControl->__sequence.load(std::memory_order_acquire) : 0;
+}
+
+SharedMemory::SlotHeader *SharedMemory::slot(uint64_t index) noexcept {
+    return reinterpret_cast<SlotHeader *>(m_userAccessibleSharedMemory + (index % m_numberOfSlots) * m_slotStride);
+}
+
+char *SharedMemory::beginWriteSlot() noexcept {
+    char *retVal{nullptr};
+    if ((0 < m_numberOfSlots) && (nullptr != m_sharedMemoryControl)) {
+        m_writingSlot = m_sharedMemoryControl->__writeIndex.load(std::memory_order_relaxed);
+        SlotHeader *s = slot(m_writingSlot);
+        s->__sequence.store(2 * m_writingSlot + 1, std::memory_order_relaxed);
+        // Make the odd sequence number visible before any modification of the slot.
+        std::atomic_thread_fence(std::memory_order_release);
+        retVal = reinterpret_cast<char *>(s) + sizeof(SlotHeader);
+    }
+    return retVal;
+}
+
+void SharedMemory::endWriteSlot(uint32_t length, const cluon::data::TimeStamp &sampleTimeStamp) noexcept {
+    if ((0 < m_numberOfSlots) && (nullptr != m_sharedMemoryControl)) {
+        SlotHeader *s = slot(m_writingSlot);
+        // Only publish a slot that was started with beginWriteSlot.
+        if ((2 * m_writingSlot + 1) == s->__sequence.load(std::memory_order_relaxed)) {
+            s->__length       = std::min(length, m_slotSize);
+            s->__seconds      = sampleTimeStamp.seconds();
+            s->__microseconds = sampleTimeStamp.microseconds();
+            s->__sequence.store(2 * m_writingSlot + 2, std::memory_order_release);
+            m_sharedMemoryControl->__writeIndex.store(m_writingSlot + 1, std::memory_order_release);
+        }
+    }
+}
+
+bool SharedMemory::readSlot(std::function<void(const char *data, uint32_t size, const cluon::data::TimeStamp &sampleTimeStamp)> delegate,
+                            SlotSelection selection) noexcept {
+    bool retVal{false};
+    if ((nullptr != delegate) && (0 < m_numberOfSlots) && (nullptr != m_sharedMemoryControl)) {
+        const uint64_t CURSOR{m_readCursor};
+        constexpr uint32_t MAX_NUMBER_OF_RETRIES{1000};
+        for (uint32_t i{0}; !retVal && (i < MAX_NUMBER_OF_RETRIES); i++) {
+            const uint64_t WRITE_INDEX{m_sharedMemoryControl->__writeIndex.load(std::memory_order_acquire)};
+            if (WRITE_INDEX <= m_readCursor) {
+                break;
+            }
+
+            uint64_t index{(SlotSelection::NEWEST == selection) ? WRITE_INDEX - 1 : m_readCursor};
+            // Older slots have been overwritten already.
+            if (WRITE_INDEX - index > m_numberOfSlots) {
+                index = WRITE_INDEX - m_numberOfSlots;
+            }
+
+            SlotHeader *s = slot(index);
+            const uint64_t BEFORE{s->__sequence.load(std::memory_order_acquire)};
+            if ((2 * index + 2) == BEFORE) {
+                const uint32_t LENGTH{std::min(s->__length, m_slotSize)};
+                cluon::data::TimeStamp sampleTimeStamp;
+                sampleTimeStamp.seconds(s->__seconds).microseconds(s->__microseconds);
+                try {
+                    delegate(reinterpret_cast<const char *>(s) + sizeof(SlotHeader), LENGTH, sampleTimeStamp);
+                } catch (...) {} // LCOV_EXCL_LINE
+                // Make sure that the slot was read before re-reading its sequence number.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                retVal = (BEFORE == s->__sequence.load(std::memory_order_relaxed));
+            }
+            // A slot that is overwritten is skipped.
+            m_readCursor = index + 1;
+        }
+        if (0 <= m_readerIndex) {
+            // All consumed slots except the one that was read were missed.
+            const uint64_t CONSUMED{m_readCursor - CURSOR};
+            updateReader(m_readCursor, (retVal ? CONSUMED - 1 : CONSUMED));
+        }
+    }
+    return retVal;
+}
+
+uint32_t SharedMemory::numberOfSlots() const noexcept {
+    return m_numberOfSlots;
+}
+
+uint32_t SharedMemory::slotSize() const noexcept {
+    return m_slotSize;
+}
+
+uint64_t SharedMemory::publishedFrames() const noexcept {
+    return (0 < m_numberOfSlots) ? m_sharedMemoryControl->__writeIndex.load() : m_sharedMemoryControl->__frameCounter.load();
+}
+
+bool SharedMemory::registerReader() noexcept {
+    bool retVal{0 <= m_readerIndex};
+    if (!retVal && (nullptr != m_sharedMemoryControl) && valid()) {
+        const uint32_t PID{processIdentifier()};
+        const int64_t NOW{cluon::time::toMicroseconds(cluon::time::now())};
+        for (uint32_t i{0}; !retVal && (i < MAX_NUMBER_OF_READERS); i++) {
+            ReaderControl &r = m_sharedMemoryControl->__readers[i];
+            uint32_t expected{r.__processID.load()};
+            int64_t lastHeartbeat{r.__heartbeat.load()};
+            const int64_t AGE{NOW - lastHeartbeat};
+            // Claim unused entries or entries of readers without heartbeat; kill()
+            // cannot tell terminated processes from those in other PID namespaces.
+            if ((0 == expected) || ((READER_TIMEOUT < AGE) && isProcessTerminated(expected)) || (10 * READER_TIMEOUT < AGE)) {
+                // Refreshing the heartbeat first lets concurrent readers skip the stale entry.
+                retVal = r.__heartbeat.compare_exchange_strong(lastHeartbeat, NOW) && r.__processID.compare_exchange_strong(expected, PID);
+            }
+            if (retVal) {
+                // Frames published before the registration are not missed.
+                if (0 == m_numberOfSlots) {
+                    m_readCursor = publishedFrames();
+                }
+                m_readerIndex     = static_cast<int32_t>(i);
+                m_readerProcessID = PID;
+                r.__missedFrames.store(0);
+                updateReader(m_readCursor, 0);
+            }
+        }
+    }
+    return retVal;
+}
+
+void SharedMemory::unregisterReader() noexcept {
+    if ((0 <= m_readerIndex) && (nullptr != m_sharedMemoryControl)) {
+        // Leave the entry untouched if another reader has reused it already.
+        uint32_t expected{m_readerProcessID};
+        m_sharedMemoryControl->__readers[m_readerIndex].__processID.compare_exchange_strong(expected, 0);
+    }
+    m_readerIndex = -1;
+}
+
+void SharedMemory::heartbeat() noexcept {
+    if ((0 <= m_readerIndex) && (nullptr != m_sharedMemoryControl)) {
+        ReaderControl &r = m_sharedMemoryControl->__readers[m_readerIndex];
+        if (m_readerProcessID != r.__processID.load(std::memory_order_relaxed)) {
+            // Another reader reused this entry after our heartbeat timed out.
+            m_readerIndex = -1;
+        } else {
+            r.__heartbeat.store(cluon::time::toMicroseconds(cluon::time::now()), std::memory_order_relaxed);
+        }
+    }
+}
+
+void SharedMemory::updateReader(uint64_t consumedFrames, uint64_t missedFrames) noexcept {
+    // The heartbeat also detects whether this entry was reused by another reader.
+    heartbeat();
+    if (0 <= m_readerIndex) {
+        ReaderControl &r = m_sharedMemoryControl->__readers[m_readerIndex];
+        r.__cursor.store(consumedFrames, std::memory_order_relaxed);
+        if (0 < missedFrames) {
+            r.__missedFrames.fetch_add(missedFrames, std::memory_order_relaxed);
+        }
+    }
+}
+
+uint64_t SharedMemory::missedFrames() const noexcept {
+    return ((0 <= m_readerIndex) && (nullptr != m_sharedMemoryControl))
+               ? m_sharedMemoryControl->__readers[m_readerIndex].__missedFrames.load(std::memory_order_relaxed)
+               : 0;
+}
+
+std::vector<SharedMemory::ReaderStatus> SharedMemory::readers() const noexcept {
+    std::vector<ReaderStatus> retVal;
+    if (nullptr != m_sharedMemoryControl) {
+        const uint64_t PUBLISHED{publishedFrames()};
+        for (const auto &r : m_sharedMemoryControl->__readers) {
+            ReaderStatus status;
+            status.processID = r.__processID.load();
+            if (0 != status.processID) {
+                status.cursor       = r.__cursor.load(std::memory_order_relaxed);
+                status.lag          = (PUBLISHED > status.cursor) ? PUBLISHED - status.cursor : 0;
+                status.missedFrames = r.__missedFrames.load(std::memory_order_relaxed);
+                status.heartbeat    = cluon::time::fromMicroseconds(r.__heartbeat.load(std::memory_order_relaxed));
+                retVal.push_back(status);
+            }
+        }
+    }
+    return retVal;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Platform-dependent implementations.
 #ifdef WIN32
@@ -270,6 +602,8 @@ void SharedMemory::initWIN32() noexcept {
     mutexName += "_mutex";
 
     if (0 < m_size) {
+        m_dataOffset = dataOffsetAfter(sizeof(SharedMemoryControl));
+
         // Create a shared memory area and semaphores.
         const LONG MUTEX_INITIAL_COUNT = 1;
         const LONG MUTEX_MAX_COUNT     = 1;
@@ -283,14 +617,16 @@ void SharedMemory::initWIN32() noexcept {
                                                    NULL /*use default security*/,
                                                    PAGE_READWRITE,
                                                    0,
-                                                   m_size + sizeof(uint32_t) /*size + size-information (uint32_t)*/,
+                                                   m_dataOffset + m_size /*size + header with size-information*/,
                                                    m_name.c_str());
                 if (nullptr != __sharedMemory) {
-                    m_sharedMemory = (char *)MapViewOfFile(__sharedMemory, FILE_MAP_ALL_ACCESS, 0, 0, m_size + sizeof(uint32_t));
+                    m_sharedMemory = (char *)MapViewOfFile(__sharedMemory, FILE_MAP_ALL_ACCESS, 0, 0, m_dataOffset + m_size);
                     if (nullptr != m_sharedMemory) {
                         // Provide size information at the beginning of the shared memory.
-                        *(uint32_t *)m_sharedMemory  = m_size;
-                        m_userAccessibleSharedMemory = m_sharedMemory + sizeof(uint32_t);
+                        m_sharedMemoryControl               = reinterpret_cast<SharedMemoryControl *>(m_sharedMemory);
+                        m_sharedMemoryControl->__size       = m_size;
+                        m_sharedMemoryControl->__dataOffset = m_dataOffset;
+                        m_userAccessibleSharedMemory        = m_sharedMemory + m_dataOffset;
                     } else {
                         std::cerr << "[cluon::SharedMemory] Failed to map shared memory '" << m_name << "': "
                                   << " (" << GetLastError() << ")" << std::endl;
@@ -337,16 +673,18 @@ void SharedMemory::initWIN32() noexcept {
             if (nullptr != __conditionEvent) {
                 __sharedMemory = OpenFileMapping(FILE_MAP_ALL_ACCESS, FALSE /*do not inherit the name*/, m_name.c_str());
                 if (nullptr != __sharedMemory) {
-                    // Firstly, map only for the size of a uint32_t to read the entire size.
-                    m_sharedMemory = (char *)MapViewOfFile(__sharedMemory, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(uint32_t));
+                    // Firstly, map only the header to read the entire size.
+                    m_sharedMemory = (char *)MapViewOfFile(__sharedMemory, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(SharedMemoryControl));
                     if (nullptr != m_sharedMemory) {
                         //  Now, read the real size...
-                        m_size = *(uint32_t *)m_sharedMemory;
+                        m_size       = reinterpret_cast<SharedMemoryControl *>(m_sharedMemory)->__size;
+                        m_dataOffset = reinterpret_cast<SharedMemoryControl *>(m_sharedMemory)->__dataOffset;
                         // ..unmap and re-map.
                         UnmapViewOfFile(m_sharedMemory);
-                        m_sharedMemory = (char *)MapViewOfFile(__sharedMemory, FILE_MAP_ALL_ACCESS, 0, 0, m_size + sizeof(uint32_t));
+                        m_sharedMemory = (char *)MapViewOfFile(__sharedMemory, FILE_MAP_ALL_ACCESS, 0, 0, m_dataOffset + m_size);
                         if (nullptr != m_sharedMemory) {
-                            m_userAccessibleSharedMemory = m_sharedMemory + sizeof(uint32_t);
+                            m_sharedMemoryControl        = reinterpret_cast<SharedMemoryControl *>(m_sharedMemory);
+                            m_userAccessibleSharedMemory = m_sharedMemory + m_dataOffset;
                         } else {
                             std::cerr << "[cluon::SharedMemory] Failed to finally map shared memory '" << m_name << "': "
                                       << " (" << GetLastError() << ")" << std::endl;
@@ -440,6 +778,23 @@ void SharedMemory::waitWIN32() noexcept {
     }
 }
 
+void SharedMemory::waitUntilWIN32(uint32_t generation, const std::chrono::steady_clock::time_point &deadline) noexcept {
+    if (nullptr != __conditionEvent) {
+        auto now{std::chrono::steady_clock::now()};
+        while ((generation == m_sharedMemoryControl->__generation.load()) && (now < deadline)) {
+            const DWORD TIMEOUT{static_cast<DWORD>(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count() + 1)};
+            const DWORD RESULT{WaitForSingleObject(__conditionEvent, TIMEOUT)};
+            if (WAIT_TIMEOUT == RESULT) {
+                break;
+            } else if (0 != RESULT) {
+                m_broken.store(true);
+                break;
+            }
+            now = std::chrono::steady_clock::now();
+        }
+    }
+}
+
 void SharedMemory::notifyAllWIN32() noexcept {
     if (nullptr != __conditionEvent) {
         if (/* Testing for equality with 0 is correct according to MSDN reference. */ 0 == SetEvent(__conditionEvent)) {
@@ -487,7 +842,8 @@ void SharedMemory::initPOSIX() noexcept {
 
         // When creating a shared memory segment, truncate it.
         if (0 < m_size) {
-            retVal = (0 == ::ftruncate(m_fd, static_cast<off_t>(sizeof(SharedMemoryHeader) + m_size)));
+            m_dataOffset = dataOffsetAfter(sizeof(SharedMemoryHeader));
+            retVal = (0 == ::ftruncate(m_fd, static_cast<off_t>(m_dataOffset + m_size)));
             if (!retVal) {
 // clang-format off // LCOV_EXCL_LINE
                 std::cerr << "[cluon::SharedMemory (POSIX)] Failed to truncate '" << m_name << "': " << ::strerror(errno) << " (" << errno << ")" << std::endl; // LCOV_EXCL_LINE
@@ -497,15 +853,22 @@ void SharedMemory::initPOSIX() noexcept {
 
         // Accessing shared memory segment.
         if (retVal) {
+            int mapFlags{MAP_SHARED};
+#ifdef MAP_POPULATE
+            if (m_options.populate) {
+                mapFlags |= MAP_POPULATE; // Prefault all pages.
+            }
+#endif
             // On opening (i.e., NOT creating) a shared memory segment, m_size is still 0 and we need to figure out the size first.
-            m_sharedMemory = static_cast<char *>(::mmap(0, sizeof(SharedMemoryHeader) + m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0));
+            m_sharedMemory = static_cast<char *>(::mmap(0, (0 < m_size) ? m_dataOffset + m_size : sizeof(SharedMemoryHeader), PROT_READ | PROT_WRITE, mapFlags, m_fd, 0));
             if (MAP_FAILED != m_sharedMemory) {
                 m_sharedMemoryHeader = reinterpret_cast<SharedMemoryHeader *>(m_sharedMemory);
 
                 // On creating (i.e., NOT opening) a shared memory segment, setup the shared memory header.
                 if (0 < m_size) {
                     // Store user accessible size in shared memory.
-                    m_sharedMemoryHeader->__size = m_size;
+                    m_sharedMemoryHeader->__control.__size       = m_size;
+                    m_sharedMemoryHeader->__control.__dataOffset = m_dataOffset;
 
                     // Create process-shared mutex (fastest approach, cf. Stevens & Rago: "Advanced Programming in the UNIX (R) Environment").
                     pthread_mutexattr_t mutexAttribute;
@@ -533,7 +896,8 @@ void SharedMemory::initPOSIX() noexcept {
                     m_hasOnlyAttachedToSharedMemory = true;
 
                     // Read size as we are attaching to an existing shared memory.
-                    m_size = m_sharedMemoryHeader->__size;
+                    m_size       = m_sharedMemoryHeader->__control.__size;
+                    m_dataOffset = m_sharedMemoryHeader->__control.__dataOffset;
 
                     // Now, as we know the real size, unmap the first mapping that did not know the size.
                     if (::munmap(m_sharedMemory, sizeof(SharedMemoryHeader))) {
@@ -547,7 +911,7 @@ void SharedMemory::initPOSIX() noexcept {
                     m_sharedMemoryHeader = nullptr;
 
                     // Re-map with the correct size parameter.
-                    m_sharedMemory = static_cast<char *>(::mmap(0, sizeof(SharedMemoryHeader) + m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0));
+                    m_sharedMemory = static_cast<char *>(::mmap(0, m_dataOffset + m_size, PROT_READ | PROT_WRITE, mapFlags, m_fd, 0));
                     if (MAP_FAILED != m_sharedMemory) {
                         m_sharedMemoryHeader = reinterpret_cast<SharedMemoryHeader *>(m_sharedMemory);
                     }
@@ -560,13 +924,9 @@ void SharedMemory::initPOSIX() noexcept {
 
             // If the shared memory segment is correctly available, store the pointer for the user data.
             if (MAP_FAILED != m_sharedMemory) {
-                m_userAccessibleSharedMemory = m_sharedMemory + sizeof(SharedMemoryHeader);
-
-                // Lock the shared memory into RAM for performance reasons.
-                if (-1 == ::mlock(m_sharedMemory, sizeof(SharedMemoryHeader) + m_size)) {
-                    std::cerr << "[cluon::SharedMemory (POSIX)] Failed to mlock shared memory: " // LCOV_EXCL_LINE
-                              << ::strerror(errno) << " (" << errno << ")" << std::endl;         // LCOV_EXCL_LINE
-                }
+                m_sharedMemoryControl        = &(m_sharedMemoryHeader->__control);
+                m_userAccessibleSharedMemory = m_sharedMemory + m_dataOffset;
+                applyOptions(false);
             }
         } else { // LCOV_EXCL_LINE
             if (-1 != m_fd) { // LCOV_EXCL_LINE
@@ -580,33 +940,18 @@ void SharedMemory::initPOSIX() noexcept {
         }
     }
 #endif
-
-#ifdef __linux__
-    // On Linux, the POSIX shared memory lives in /dev/shm and we have a valid
-    // file descriptor to use for timestamping.
-    if (-1 != m_fd) {
-        m_fdForTimeStamping = m_fd;
-    }
-#else
-#if !defined(__NetBSD__) && !defined(__OpenBSD__)
-    // On *BSDs, the POSIX shared memory lives not in /dev/shm and we have
-    // need to use a separate file for timestamping.
-    if (-1 != m_fd) {
-        m_fdForTimeStamping = ::open(m_nameForTimeStamping.c_str(), O_CREAT|O_RDONLY, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
-    }
-#endif
-#endif
 }
 
 void SharedMemory::deinitPOSIX() noexcept {
 #if !defined(__NetBSD__) && !defined(__OpenBSD__)
     if ((nullptr != m_sharedMemoryHeader) && (!m_hasOnlyAttachedToSharedMemory)) {
         // Wake any waiting threads as we are going to end the shared memory session.
+        m_sharedMemoryHeader->__control.__generation.fetch_add(1);
         ::pthread_cond_broadcast(&(m_sharedMemoryHeader->__condition));
         ::pthread_cond_destroy(&(m_sharedMemoryHeader->__condition));
         ::pthread_mutex_destroy(&(m_sharedMemoryHeader->__mutex));
     }
-    if ((nullptr != m_sharedMemory) && ::munmap(m_sharedMemory, sizeof(SharedMemoryHeader) + m_size)) {
+    if ((nullptr != m_sharedMemory) && ::munmap(m_sharedMemory, m_dataOffset + m_size)) {
 // clang-format off // LCOV_EXCL_LINE
         std::cerr << "[cluon::SharedMemory (POSIX)] Failed to unmap shared memory: " << ::strerror(errno) << " (" << errno << ")" << std::endl; // LCOV_EXCL_LINE
 // clang-format on // LCOV_EXCL_LINE
@@ -617,15 +962,6 @@ void SharedMemory::deinitPOSIX() noexcept {
 // clang-format on // LCOV_EXCL_LINE
     }
 #endif
-
-#ifndef __linux__
-    // On *BSDs, the POSIX shared memory lives not in /dev/shm and we have
-    // used a separate file for timestamping.
-    if (-1 != m_fdForTimeStamping) {
-        ::close(m_fdForTimeStamping);
-        ::unlink(m_nameForTimeStamping.c_str());
-    }
-#endif
 }
 
 void SharedMemory::lockPOSIX() noexcept {
@@ -633,9 +969,7 @@ void SharedMemory::lockPOSIX() noexcept {
     if (nullptr != m_sharedMemoryHeader) {
         auto retVal = ::pthread_mutex_lock(&(m_sharedMemoryHeader->__mutex));
         if (EOWNERDEAD == retVal) {
-// clang-format off // LCOV_EXCL_LINE
-            std::cerr << "[cluon::SharedMemory (POSIX)] pthread_mutex_lock returned for EOWNERDEAD for mutex in shared memory '" << m_name << "': " << ::strerror(errno) << " (" << errno << ")" << std::endl; // LCOV_EXCL_LINE
-// clang-format on // LCOV_EXCL_LINE
+            recoverPOSIX();
         } else if (0 != retVal) {
             m_broken.store(true); // LCOV_EXCL_LINE
         }
@@ -643,6 +977,16 @@ void SharedMemory::lockPOSIX() noexcept {
 #endif
 }
 
+void SharedMemory::recoverPOSIX() noexcept {
+#if !defined(__NetBSD__) && !defined(__OpenBSD__) && !defined(__APPLE__)
+    // The previous owner of the mutex terminated while holding it; mark the mutex as usable again.
+    std::cerr << "[cluon::SharedMemory (POSIX)] Recovering mutex in shared memory '" << m_name << "' from a terminated owner." << std::endl;
+    if (0 != ::pthread_mutex_consistent(&(m_sharedMemoryHeader->__mutex))) {
+        m_broken.store(true); // LCOV_EXCL_LINE
+    }
+#endif
+}
+
 void SharedMemory::unlockPOSIX() noexcept {
 #if !defined(__NetBSD__) && !defined(__OpenBSD__)
     if (nullptr != m_sharedMemoryHeader) {
@@ -665,6 +1009,42 @@ void SharedMemory::waitPOSIX() noexcept {
 #endif
 }
 
+void SharedMemory::waitUntilPOSIX(uint32_t generation, const std::chrono::steady_clock::time_point &deadline) noexcept {
+#if !defined(__NetBSD__) && !defined(__OpenBSD__)
+    if (nullptr != m_sharedMemoryHeader) {
+        // The condition uses CLOCK_MONOTONIC (cf. initPOSIX) like std::chrono::steady_clock.
+        const auto REMAINING{std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now()).count()};
+        struct timespec ts {};
+#ifdef __APPLE__
+        ::clock_gettime(CLOCK_REALTIME, &ts);
+#else
+        ::clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+        const int64_t NANOSECONDS{static_cast<int64_t>(ts.tv_nsec) + std::max<int64_t>(REMAINING, 0)};
+        ts.tv_sec += static_cast<time_t>(NANOSECONDS / 1000000000L);
+        ts.tv_nsec = static_cast<long>(NANOSECONDS % 1000000000L);
+
+        lock();
+        // Repeat waiting on spurious wakeups.
+        while (generation == m_sharedMemoryControl->__generation.load()) {
+            auto retVal = ::pthread_cond_timedwait(&(m_sharedMemoryHeader->__condition), &(m_sharedMemoryHeader->__mutex), &ts);
+            if (EOWNERDEAD == retVal) {
+                recoverPOSIX();
+            } else if (ETIMEDOUT == retVal) {
+                break;
+            } else if (0 != retVal) {
+                m_broken.store(true); // LCOV_EXCL_LINE
+                break;                // LCOV_EXCL_LINE
+            }
+        }
+        unlock();
+    }
+#else
+    (void)generation;
+    (void)deadline;
+#endif
+}
+
 void SharedMemory::notifyAllPOSIX() noexcept {
 #if !defined(__NetBSD__) && !defined(__OpenBSD__)
     if (nullptr != m_sharedMemoryHeader) {
@@ -675,6 +1055,67 @@ void SharedMemory::notifyAllPOSIX() noexcept {
 #endif
 }
 
+void SharedMemory::waitUntilFutex(uint32_t generation, const std::chrono::steady_clock::time_point &deadline) noexcept {
+#ifdef __linux__
+    // Announce this waiter before comparing the generation in the kernel so that notifyAllFutex() cannot miss it.
+    m_sharedMemoryControl->__futexWaiters.fetch_add(1);
+    // Repeat waiting on spurious wakeups.
+    while (generation == m_sharedMemoryControl->__generation.load()) {
+        struct timespec ts {};
+        struct timespec *timeout{nullptr};
+        if (std::chrono::steady_clock::time_point::max() != deadline) {
+            const auto REMAINING{std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now()).count()};
+            if (0 >= REMAINING) {
+                break;
+            }
+            ts.tv_sec  = static_cast<time_t>(REMAINING / 1000000000L);
+            ts.tv_nsec = static_cast<long>(REMAINING % 1000000000L);
+            timeout    = &ts;
+        }
+        if ((-1 == ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&(m_sharedMemoryControl->__generation)), FUTEX_WAIT, generation, timeout, nullptr, 0))
+            && (EAGAIN != errno) && (EINTR != errno) && (ETIMEDOUT != errno)) {
+            std::cerr << "[cluon::SharedMemory] Failed to wait on futex: " << ::strerror(errno) << " (" << errno << ")" << std::endl; // LCOV_EXCL_LINE
+            m_broken.store(true);                                                                                                   // LCOV_EXCL_LINE
+            break;                                                                                                                  // LCOV_EXCL_LINE
+        }
+    }
+    m_sharedMemoryControl->__futexWaiters.fetch_sub(1);
+#else
+    (void)generation;
+    (void)deadline;
+#endif
+}
+
+void SharedMemory::notifyAllFutex() noexcept {
+#ifdef __linux__
+    // Avoid the system call when nobody is waiting.
+    if (0 < m_sharedMemoryControl->__futexWaiters.load()) {
+        ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&(m_sharedMemoryControl->__generation)), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+    }
+#endif
+}
+
+void SharedMemory::applyOptions(bool prefault) noexcept {
+    const std::size_t LENGTH{static_cast<std::size_t>(m_dataOffset) + m_size};
+#ifdef MADV_HUGEPAGE
+    if (m_options.hugePages) {
+        // Ask for transparent huge pages; ignored when not supported for shared memory.
+        ::madvise(m_sharedMemory, LENGTH, MADV_HUGEPAGE);
+    }
+#endif
+    if (m_options.populate && prefault) {
+        // Touch every page to avoid page faults when accessing the data later.
+        volatile char sum{0};
+        for (std::size_t i{0}; i < LENGTH; i += PAGE_SIZE) { sum = static_cast<char>(sum + m_sharedMemory[i]); }
+    }
+    if (m_options.lock) {
+        // Lock the shared memory into RAM for performance reasons.
+        if (-1 == ::mlock(m_sharedMemory, LENGTH)) {
+            std::cerr << "[cluon::SharedMemory] Failed to mlock shared memory: " << ::strerror(errno) << " (" << errno << ")" << std::endl;
+        }
+    }
+}
+
 bool SharedMemory::validPOSIX() noexcept {
 #if !defined(__NetBSD__) && !defined(__OpenBSD__)
     return (-1 != m_fd) && (MAP_FAILED != m_sharedMemory);
@@ -749,13 +1190,31 @@ void SharedMemory::initSysV() noexcept {
                 }
 
                 // Now, create the shared memory segment.
-                m_sharedMemoryIDSysV = ::shmget(m_shmKeySysV, m_size, IPC_CREAT | IPC_EXCL | S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+                m_dataOffset = dataOffsetAfter(sizeof(SharedMemoryControl));
+#ifdef SHM_HUGETLB
+                if (m_options.hugePages) {
+                    // Segments with huge pages need to be a multiple of the huge page size.
+                    const uint64_t SIZE{((static_cast<uint64_t>(m_dataOffset) + m_size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE};
+                    m_sharedMemoryIDSysV = ::shmget(m_shmKeySysV, SIZE, SHM_HUGETLB | IPC_CREAT | IPC_EXCL | S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+                    if (-1 == m_sharedMemoryIDSysV) {
+                        std::clog << "[cluon::SharedMemory (SysV)] Huge pages not available: " << ::strerror(errno) << " (" << errno << "); using regular pages." << std::endl;
+                    }
+                }
+#endif
+                if (-1 == m_sharedMemoryIDSysV) {
+                    m_sharedMemoryIDSysV = ::shmget(m_shmKeySysV, m_dataOffset + m_size, IPC_CREAT | IPC_EXCL | S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+                }
                 if (-1 != m_sharedMemoryIDSysV) {
                     m_sharedMemory = reinterpret_cast<char *>(::shmat(m_sharedMemoryIDSysV, nullptr, 0));
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wold-style-cast"
                     if ((void *)-1 != m_sharedMemory) {
-                        m_userAccessibleSharedMemory = m_sharedMemory;
+                        // Provide size information at the beginning of the shared memory.
+                        m_sharedMemoryControl               = reinterpret_cast<SharedMemoryControl *>(m_sharedMemory);
+                        m_sharedMemoryControl->__size       = m_size;
+                        m_sharedMemoryControl->__dataOffset = m_dataOffset;
+                        m_userAccessibleSharedMemory        = m_sharedMemory + m_dataOffset;
+                        applyOptions(true);
                     } else { // LCOV_EXCL_LINE
 // clang-format off // LCOV_EXCL_LINE
                         std::cerr << "[cluon::SharedMemory (SysV)] Failed to attach to shared memory (0x" << std::hex << m_shmKeySysV << std::dec << "): " << ::strerror(errno) << " (" << errno << ")" << std::endl; // LCOV_EXCL_LINE
@@ -773,12 +1232,19 @@ void SharedMemory::initSysV() noexcept {
                 if (-1 != m_sharedMemoryIDSysV) {
                     struct shmid_ds info;
                     if (-1 != ::shmctl(m_sharedMemoryIDSysV, IPC_STAT, &info)) {
-                        m_size = static_cast<uint32_t>(info.shm_segsz);
                         m_sharedMemory = reinterpret_cast<char *>(::shmat(m_sharedMemoryIDSysV, nullptr, 0));
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wold-style-cast"
                         if ((void *)-1 != m_sharedMemory) {
-                            m_userAccessibleSharedMemory = m_sharedMemory;
+                            m_sharedMemoryControl = reinterpret_cast<SharedMemoryControl *>(m_sharedMemory);
+                            // Read size and layout as we are attaching to an existing shared memory.
+                            if ((sizeof(SharedMemoryControl) <= info.shm_segsz)
+                                && (static_cast<uint64_t>(m_sharedMemoryControl->__dataOffset) + m_sharedMemoryControl->__size <= info.shm_segsz)) {
+                                m_size       = m_sharedMemoryControl->__size;
+                                m_dataOffset = m_sharedMemoryControl->__dataOffset;
+                            }
+                            m_userAccessibleSharedMemory = m_sharedMemory + m_dataOffset;
+                            applyOptions(true);
                         } else { // LCOV_EXCL_LINE
 // clang-format off // LCOV_EXCL_LINE
                             std::cerr << "[cluon::SharedMemory (SysV)] Failed to attach to shared memory (0x" << std::hex << m_shmKeySysV << std::dec << "): " << ::strerror(errno) << " (" << errno << ")" << std::endl; // LCOV_EXCL_LINE
@@ -916,19 +1382,10 @@ void SharedMemory::initSysV() noexcept {
             }
         }
     }
-
-    // If the shared memory is present, open the token file for the time stamping.
-    if (nullptr != m_sharedMemory) {
-        m_fdForTimeStamping = ::open(m_name.c_str(), O_RDONLY);
-    }
 }
 
 void SharedMemory::deinitSysV() noexcept {
     if (nullptr != m_sharedMemory) {
-        // Close token file.
-        ::close(m_fdForTimeStamping);
-        m_fdForTimeStamping = -1;
-
         if (-1 == ::shmdt(m_sharedMemory)) {
 // clang-format off // LCOV_EXCL_LINE
             std::cerr << "[cluon::SharedMemory (SysV)] Could not detach shared memory (0x" << std::hex << m_shmKeySysV << std::dec << "): " << ::strerror(errno) << " (" << errno << ")" << std::endl; // LCOV_EXCL_LINE
@@ -937,6 +1394,13 @@ void SharedMemory::deinitSysV() noexcept {
     }
 
     if (!m_hasOnlyAttachedToSharedMemory) {
+        // Remove the token file first so that no process attaches to the
+        // semaphores and the shared memory segment that are removed next.
+        if (-1 == ::unlink(m_name.c_str())) {
+            std::cerr << "[cluon::SharedMemory (SysV)] Token file '" << m_name << "' could not be removed: " << ::strerror(errno) << " (" << errno << ")"
+                      << std::endl;
+        }
+
         notifyAllSysV();
 
         if (-1 != m_conditionIDSysV) {
@@ -958,11 +1422,6 @@ void SharedMemory::deinitSysV() noexcept {
                           << ") could not be removed: " << ::strerror(errno) << " (" << errno << ")" << std::endl;
             }
         }
-
-        if (-1 == ::unlink(m_name.c_str())) {
-            std::cerr << "[cluon::SharedMemory (SysV)] Token file '" << m_name << "' could not be removed: " << ::strerror(errno) << " (" << errno << ")"
-                      << std::endl;
-        }
     }
 }
 
@@ -1017,6 +1476,47 @@ void SharedMemory::waitSysV() noexcept {
     }
 }
 
+void SharedMemory::waitUntilSysV(uint32_t generation, const std::chrono::steady_clock::time_point &deadline) noexcept {
+    if (-1 != m_conditionIDSysV) {
+        constexpr int NUMBER_OF_SEMAPHORE_TO_CONTROL{0};
+        constexpr int VALUE{0}; // Wait for this semaphore to become 0.
+
+        auto now{std::chrono::steady_clock::now()};
+        while ((generation == m_sharedMemoryControl->__generation.load()) && (now < deadline)) {
+            struct sembuf tmp;
+            tmp.sem_num = NUMBER_OF_SEMAPHORE_TO_CONTROL;
+            tmp.sem_op = VALUE;
+#ifdef __linux__
+            tmp.sem_flg = 0;
+            const auto REMAINING{std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count()};
+            struct timespec ts {};
+            ts.tv_sec  = static_cast<time_t>(REMAINING / 1000000000L);
+            ts.tv_nsec = static_cast<long>(REMAINING % 1000000000L);
+            if (-1 == ::semtimedop(m_conditionIDSysV, &tmp, 1, &ts)) {
+                if (EAGAIN == errno) {
+                    break;
+                } else if (EINTR != errno) {
+#else
+            // Without semtimedop, poll the semaphore.
+            tmp.sem_flg = IPC_NOWAIT;
+            if (-1 == ::semop(m_conditionIDSysV, &tmp, 1)) {
+                if (EAGAIN == errno) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                } else if (EINTR != errno) {
+#endif
+                    std::cerr << "[cluon::SharedMemory (SysV)] Failed to wait on semaphore (0x" << std::hex << m_conditionKeySysV << std::dec
+                              << "): " << ::strerror(errno) << " (" << errno << ")" << std::endl;
+                    m_broken.store(true);
+                    break;
+                }
+            } else {
+                break;
+            }
+            now = std::chrono::steady_clock::now();
+        }
+    }
+}
+
 void SharedMemory::notifyAllSysV() noexcept {
     if (-1 != m_conditionIDSysV) {
         {
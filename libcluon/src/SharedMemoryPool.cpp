@@ -0,0 +1,363 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "cluon/SharedMemoryPool.hpp"
+#include "cluon/Time.hpp"
+
+// clang-format off
+#ifdef WIN32
+    #include <process.h>
+#else
+    #include <unistd.h>
+#endif
+// clang-format on
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <thread>
+
+namespace cluon {
+
+namespace {
+constexpr uint32_t POOL_MAGIC{0x0DA4B002};
+constexpr uint32_t CACHE_LINE{64};
+// Maximum number of attached instances that hold on to stored payloads; one bit per reader in SlotHeader::pending.
+constexpr uint32_t MAX_READERS{64};
+// Owner of a reader entry while the entry of a dead reader is being reclaimed.
+constexpr uint64_t RECLAIMING{UINT64_MAX};
+
+int64_t nowInMicroseconds() noexcept {
+    return cluon::time::toMicroseconds(cluon::time::now());
+}
+uint64_t readerOwner() noexcept {
+    // Several instances in one process are distinguished by a counter.
+    static std::atomic<uint32_t> counter{0};
+#ifdef WIN32
+    const uint32_t PID{static_cast<uint32_t>(::_getpid())};
+#else
+    const uint32_t PID{static_cast<uint32_t>(::getpid())};
+#endif
+    return (static_cast<uint64_t>(PID) << 32) | ((counter.fetch_add(1) % 0x7FFFFFFF) + 1);
+}
+} // namespace
+
+constexpr int64_t SharedMemoryPool::HEARTBEAT_TIMEOUT;
+
+// An attached instance is owned by (processIdentifier << 32) | counter and is kept alive by its heartbeat.
+struct SharedMemoryPool::Reader {
+    std::atomic<uint64_t> owner; // 0 if the entry is unused.
+    std::atomic<int64_t> heartbeat; // Microseconds since the epoch.
+};
+
+// The pool's header resides at the beginning of the shared memory area.
+struct SharedMemoryPool::PoolHeader {
+    std::atomic<uint32_t> magic;
+    uint32_t numberOfSlots;
+    uint32_t slotSize;
+    uint32_t slotStride;
+    alignas(CACHE_LINE) std::atomic<uint32_t> generation;
+    std::atomic<int64_t> ownerHeartbeat; // 0 once the owner has gone.
+    alignas(CACHE_LINE) Reader readers[MAX_READERS];
+};
+
+// Every slot is preceded by a header; generation is 0 while the owner is
+// storing a payload and identifies the stored payload afterwards. Every reader
+// that was attached when the payload was stored has its bit set in pending
+// until it has accessed the payload.
+struct SharedMemoryPool::SlotHeader {
+    std::atomic<uint32_t> references;
+    std::atomic<uint32_t> generation;
+    uint32_t length;
+    std::atomic<uint64_t> pending;
+};
+
+SharedMemoryPool::SharedMemoryPool(const std::string &name, uint32_t numberOfSlots, uint32_t slotSize) noexcept {
+    if ((0 < numberOfSlots) && (0 < slotSize)) {
+        const uint64_t STRIDE{((sizeof(SlotHeader) + static_cast<uint64_t>(slotSize) + CACHE_LINE - 1) / CACHE_LINE) * CACHE_LINE};
+        const uint64_t SIZE{sizeof(PoolHeader) + numberOfSlots * STRIDE};
+        if (SIZE < UINT32_MAX) {
+            m_sharedMemory = std::make_unique<cluon::SharedMemory>(name, static_cast<uint32_t>(SIZE));
+            if (m_sharedMemory->valid()) {
+                PoolHeader *header    = new (m_sharedMemory->data()) PoolHeader;
+                header->numberOfSlots = numberOfSlots;
+                header->slotSize      = slotSize;
+                header->slotStride    = static_cast<uint32_t>(STRIDE);
+                header->generation.store(0);
+                header->ownerHeartbeat.store(nowInMicroseconds());
+                for (auto &r : header->readers) {
+                    r.owner.store(0);
+                    r.heartbeat.store(0);
+                }
+                for (uint32_t i{0}; i < numberOfSlots; i++) {
+                    SlotHeader *s = new (m_sharedMemory->data() + sizeof(PoolHeader) + i * STRIDE) SlotHeader;
+                    s->references.store(0);
+                    s->generation.store(0);
+                    s->length = 0;
+                    s->pending.store(0);
+                }
+                // Publishing the magic number marks the pool as ready.
+                header->magic.store(POOL_MAGIC);
+
+                m_header        = header;
+                m_slots         = m_sharedMemory->data() + sizeof(PoolHeader);
+                m_numberOfSlots = numberOfSlots;
+                m_slotSize      = slotSize;
+                m_isOwner       = true;
+            }
+        }
+    }
+}
+
+SharedMemoryPool::SharedMemoryPool(const std::string &name) noexcept
+    : m_sharedMemory{std::make_unique<cluon::SharedMemory>(name)} {
+    if (m_sharedMemory->valid() && (m_sharedMemory->size() >= sizeof(PoolHeader))) {
+        PoolHeader *header = reinterpret_cast<PoolHeader *>(m_sharedMemory->data());
+        // Allow the creating process to finish the initialization.
+        for (uint32_t i{0}; (i < 100) && (POOL_MAGIC != header->magic.load()); i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if ((POOL_MAGIC == header->magic.load())
+            && (m_sharedMemory->size() >= sizeof(PoolHeader) + static_cast<uint64_t>(header->numberOfSlots) * header->slotStride)) {
+            m_header        = header;
+            m_slots         = m_sharedMemory->data() + sizeof(PoolHeader);
+            m_numberOfSlots = header->numberOfSlots;
+            m_slotSize      = header->slotSize;
+            registerReader();
+        }
+    }
+}
+
+SharedMemoryPool::~SharedMemoryPool() noexcept {
+    if (nullptr != m_header) {
+        if (m_isOwner) {
+            // Let attached instances know that no more payloads will be stored.
+            m_header->ownerHeartbeat.store(0);
+        } else if (0 <= m_readerIndex) {
+            Reader &r{m_header->readers[m_readerIndex]};
+            uint64_t expected{m_readerOwner};
+            if (r.owner.compare_exchange_strong(expected, RECLAIMING)) {
+                releasePending(static_cast<uint32_t>(m_readerIndex));
+                r.owner.store(0);
+            }
+        }
+    }
+    m_header = nullptr;
+    m_slots  = nullptr;
+    m_sharedMemory.reset(nullptr);
+}
+
+bool SharedMemoryPool::valid() noexcept {
+    bool retVal{(nullptr != m_header) && m_sharedMemory && m_sharedMemory->valid()};
+    if (retVal && !m_isOwner) {
+        // An attached pool is only usable while its owner is alive.
+        const int64_t OWNER_HEARTBEAT{m_header->ownerHeartbeat.load(std::memory_order_relaxed)};
+        retVal = (0 != OWNER_HEARTBEAT) && (HEARTBEAT_TIMEOUT >= nowInMicroseconds() - OWNER_HEARTBEAT);
+    }
+    return retVal;
+}
+
+uint32_t SharedMemoryPool::numberOfSlots() const noexcept {
+    return m_numberOfSlots;
+}
+
+uint32_t SharedMemoryPool::slotSize() const noexcept {
+    return m_slotSize;
+}
+
+SharedMemoryPool::SlotHeader *SharedMemoryPool::slot(uint32_t index) noexcept {
+    return reinterpret_cast<SlotHeader *>(m_slots + static_cast<uint64_t>(index) * m_header->slotStride);
+}
+
+bool SharedMemoryPool::tryToAcquire(uint32_t index) noexcept {
+    SlotHeader *s = slot(index);
+    uint32_t expected{0};
+    if ((0 != s->pending.load()) || !s->references.compare_exchange_strong(expected, 1)) {
+        return false;
+    }
+    // Invalidate the previous payload; accesses that started before still
+    // hold a reference or their pending bit and make us give up the slot for now.
+    s->generation.store(0);
+    if ((1 != s->references.load()) || (0 != s->pending.load())) {
+        s->references.fetch_sub(1);
+        return false;
+    }
+    return true;
+}
+
+void SharedMemoryPool::registerReader() noexcept {
+    const uint64_t OWNER{readerOwner()};
+    const int64_t NOW{nowInMicroseconds()};
+    for (uint32_t i{0}; i < MAX_READERS; i++) {
+        Reader &r{m_header->readers[i]};
+        uint64_t expected{r.owner.load()};
+        int64_t lastHeartbeat{r.heartbeat.load()};
+        // Claim unused entries or entries of readers without heartbeat; refreshing
+        // the heartbeat first lets the owner and concurrent readers skip the entry.
+        if (((0 == expected) || (HEARTBEAT_TIMEOUT < NOW - lastHeartbeat)) && r.heartbeat.compare_exchange_strong(lastHeartbeat, NOW)
+            && r.owner.compare_exchange_strong(expected, OWNER)) {
+            // Payloads that are still pending for a dead reader are released.
+            releasePending(i);
+            m_readerIndex = static_cast<int32_t>(i);
+            m_readerOwner = OWNER;
+            break;
+        }
+    }
+}
+
+void SharedMemoryPool::reclaimReaders() noexcept {
+    const int64_t NOW{nowInMicroseconds()};
+    for (uint32_t i{0}; i < MAX_READERS; i++) {
+        Reader &r{m_header->readers[i]};
+        uint64_t expected{r.owner.load()};
+        int64_t lastHeartbeat{r.heartbeat.load()};
+        if ((0 != expected) && (HEARTBEAT_TIMEOUT < NOW - lastHeartbeat) && r.heartbeat.compare_exchange_strong(lastHeartbeat, NOW)
+            && r.owner.compare_exchange_strong(expected, RECLAIMING)) {
+            releasePending(i);
+            r.owner.store(0);
+        }
+    }
+}
+
+void SharedMemoryPool::releasePending(uint32_t readerIndex) noexcept {
+    const uint64_t BIT{static_cast<uint64_t>(1) << readerIndex};
+    for (uint32_t i{0}; i < m_numberOfSlots; i++) {
+        slot(i)->pending.fetch_and(~BIT);
+    }
+}
+
+uint64_t SharedMemoryPool::pendingReaders() noexcept {
+    uint64_t pending{0};
+    for (uint32_t i{0}; i < MAX_READERS; i++) {
+        const uint64_t OWNER{m_header->readers[i].owner.load()};
+        if ((0 != OWNER) && (RECLAIMING != OWNER)) {
+            pending |= (static_cast<uint64_t>(1) << i);
+        }
+    }
+    return pending;
+}
+
+void SharedMemoryPool::heartbeat() noexcept {
+    if (nullptr != m_header) {
+        const int64_t NOW{nowInMicroseconds()};
+        if (m_isOwner) {
+            m_header->ownerHeartbeat.store(NOW, std::memory_order_relaxed);
+        } else if (0 <= m_readerIndex) {
+            Reader &r{m_header->readers[m_readerIndex]};
+            if (m_readerOwner != r.owner.load()) {
+                // Our heartbeat timed out and the entry was reclaimed; payloads stored from now on are kept for us again.
+                m_readerIndex = -1;
+                registerReader();
+            } else {
+                r.heartbeat.store(NOW, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+uint64_t SharedMemoryPool::store(const std::string &data) noexcept {
+    if (!m_isOwner || (nullptr == m_header) || (data.size() > m_slotSize)) {
+        return 0;
+    }
+    heartbeat();
+    reclaimReaders();
+
+    // Prefer free slots; otherwise, release the oldest stored payloads one by one;
+    // slots with payloads that are still pending for an attached reader are kept.
+    int64_t index{-1};
+    for (uint32_t attempt{0}; (0 > index) && (attempt <= m_numberOfSlots); attempt++) {
+        for (uint32_t i{0}; (0 > index) && (i < m_numberOfSlots); i++) {
+            if (tryToAcquire(i)) {
+                index = i;
+            }
+        }
+        if ((0 > index) && !m_storedSlots.empty()) {
+            slot(m_storedSlots.front())->references.fetch_sub(1);
+            m_storedSlots.pop_front();
+        }
+    }
+    if (0 > index) {
+        return 0;
+    }
+
+    const uint32_t INDEX{static_cast<uint32_t>(index)};
+    uint32_t generation{m_header->generation.fetch_add(1) + 1};
+    if (0 == generation) {
+        generation = m_header->generation.fetch_add(1) + 1;
+    }
+
+    SlotHeader *s = slot(INDEX);
+    s->length     = static_cast<uint32_t>(data.size());
+    std::memcpy(reinterpret_cast<char *>(s) + sizeof(SlotHeader), data.data(), data.size());
+    s->pending.store(pendingReaders());
+    s->generation.store(generation, std::memory_order_release);
+
+    // Keep a reference until the slot is needed for another payload.
+    m_storedSlots.push_back(INDEX);
+    return (static_cast<uint64_t>(generation) << 32) | (INDEX + 1);
+}
+
+bool SharedMemoryPool::access(uint64_t reference, std::function<void(const char *data, uint32_t length)> delegate) noexcept {
+    const uint32_t INDEX{static_cast<uint32_t>(reference & 0xFFFFFFFF)};
+    const uint32_t GENERATION{static_cast<uint32_t>(reference >> 32)};
+    if ((nullptr == m_header) || (nullptr == delegate) || (0 == INDEX) || (INDEX > m_numberOfSlots) || (0 == GENERATION)) {
+        return false;
+    }
+    heartbeat();
+
+    SlotHeader *s = slot(INDEX - 1);
+    bool retVal{false};
+    if (0 <= m_readerIndex) {
+        // Registered readers protect the payload with their pending bit that is
+        // checked by the owner after invalidating a slot.
+        const uint64_t BIT{static_cast<uint64_t>(1) << m_readerIndex};
+        const bool WAS_PENDING{0 != (s->pending.fetch_or(BIT) & BIT)};
+        retVal = (GENERATION == s->generation.load());
+        if (retVal) {
+            const uint32_t LENGTH{(s->length > m_slotSize) ? m_slotSize : s->length};
+            try {
+                delegate(reinterpret_cast<const char *>(s) + sizeof(SlotHeader), LENGTH);
+            } catch (...) {} // LCOV_EXCL_LINE
+        }
+        // Keep the bit if it belongs to a newer payload in this slot.
+        if (retVal || !WAS_PENDING) {
+            s->pending.fetch_and(~BIT);
+        }
+
+        // References are passed in the order of storing; hence, older payloads
+        // that are still pending were missed and are released.
+        for (uint32_t i{0}; i < m_numberOfSlots; i++) {
+            SlotHeader *other = slot(i);
+            const uint32_t OTHER_GENERATION{other->generation.load()};
+            if ((0 != (other->pending.load() & BIT)) && (0 != OTHER_GENERATION)
+                && (0 > static_cast<int32_t>(OTHER_GENERATION - GENERATION))) {
+                other->pending.fetch_and(~BIT);
+            }
+        }
+    } else {
+        // Take a reference unless the slot was released already.
+        uint32_t references{s->references.load()};
+        do {
+            if (0 == references) {
+                return false;
+            }
+        } while (!s->references.compare_exchange_weak(references, references + 1));
+
+        retVal = (GENERATION == s->generation.load(std::memory_order_acquire));
+        if (retVal) {
+            const uint32_t LENGTH{(s->length > m_slotSize) ? m_slotSize : s->length};
+            try {
+                delegate(reinterpret_cast<const char *>(s) + sizeof(SlotHeader), LENGTH);
+            } catch (...) {} // LCOV_EXCL_LINE
+        }
+        s->references.fetch_sub(1);
+    }
+    return retVal;
+}
+
+} // namespace cluon
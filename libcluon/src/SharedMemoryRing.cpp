@@ -0,0 +1,395 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "cluon/SharedMemoryRing.hpp"
+#include "cluon/Time.hpp"
+
+// clang-format off
+#ifdef WIN32
+    #include <process.h>
+#else
+    #include <unistd.h>
+    #ifdef __linux__
+        #include <linux/futex.h>
+        #include <sys/syscall.h>
+        #include <ctime>
+    #endif
+#endif
+// clang-format on
+
+#include <climits>
+#include <cstring>
+#include <new>
+#include <thread>
+
+namespace cluon {
+
+namespace {
+constexpr uint32_t RING_MAGIC{0x0DA4A1E7};
+constexpr uint32_t MAX_PARTICIPANTS{64};
+constexpr uint32_t CACHE_LINE{64};
+// Time after which an entry that is still being written is considered abandoned by its producer.
+constexpr std::chrono::milliseconds STALL_LIMIT{1000};
+// Flag in the number of attached instances marking a ring that is being removed by its last subscriber.
+constexpr uint32_t CLOSED{0x80000000};
+// Number of attempts to attach to a ring while the ring with the same name is being removed.
+constexpr uint32_t MAX_ATTEMPTS{100};
+// Time in microseconds without heartbeat after which a participant is considered dead.
+constexpr int64_t PARTICIPANT_TIMEOUT{2 * 1000 * 1000};
+// Interval to refresh the heartbeats of this process' participants.
+constexpr std::chrono::milliseconds HEARTBEAT_INTERVAL{250};
+
+int32_t processIdentifier() noexcept {
+#ifdef WIN32
+    return static_cast<int32_t>(::_getpid());
+#else
+    return static_cast<int32_t>(::getpid());
+#endif
+}
+uint64_t participantOwner(uint16_t id) noexcept {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(processIdentifier())) << 16) | id;
+}
+} // namespace
+
+// A participant is owned by (processIdentifier << 16) | id and is kept alive by its heartbeat.
+struct SharedMemoryRing::Participant {
+    std::atomic<uint64_t> owner; // 0 if the entry is unused.
+    std::atomic<int64_t> heartbeat; // Microseconds since the epoch.
+};
+
+// The ring's header resides at the beginning of the shared memory area.
+struct SharedMemoryRing::RingHeader {
+    std::atomic<uint32_t> magic;
+    uint32_t numberOfSlots;
+    uint32_t slotSize;
+    uint32_t slotStride;
+    std::atomic<uint32_t> attached; // Number of attached instances; CLOSED once the last one detaches.
+    alignas(CACHE_LINE) std::atomic<uint64_t> writeIndex;
+    alignas(CACHE_LINE) std::atomic<uint32_t> generation;
+    std::atomic<uint32_t> waiters;
+    alignas(CACHE_LINE) Participant participants[MAX_PARTICIPANTS];
+};
+
+// Every slot is preceded by a header; sequence is odd while being written
+// and 2*(index+1) once the entry for the given ring index is committed.
+struct SharedMemoryRing::SlotHeader {
+    std::atomic<uint64_t> sequence;
+    uint32_t length;
+    int32_t producer;
+};
+
+SharedMemoryRing::SharedMemoryRing(const std::string &name, uint32_t numberOfSlots, uint32_t slotSize) noexcept {
+    for (uint32_t attempt{0}; (attempt < MAX_ATTEMPTS) && !attach(name, numberOfSlots, slotSize, (MAX_ATTEMPTS - 1) == attempt); attempt++) {
+        // The ring with this name is being removed; wait for its last subscriber to finish.
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+bool SharedMemoryRing::attach(const std::string &name, uint32_t numberOfSlots, uint32_t slotSize, bool replaceClosedRing) noexcept {
+    // Firstly, try to attach to an existing ring.
+    m_sharedMemory = std::make_unique<cluon::SharedMemory>(name);
+    if (!m_sharedMemory->valid() || (m_sharedMemory->size() < sizeof(RingHeader))) {
+        m_sharedMemory.reset(nullptr);
+        if ((0 < numberOfSlots) && (0 < slotSize)) {
+            const uint32_t STRIDE{((static_cast<uint32_t>(sizeof(SlotHeader)) + slotSize + CACHE_LINE - 1) / CACHE_LINE) * CACHE_LINE};
+            const uint64_t SIZE{sizeof(RingHeader) + static_cast<uint64_t>(numberOfSlots) * STRIDE};
+            if (SIZE < UINT32_MAX) {
+                m_sharedMemory = std::make_unique<cluon::SharedMemory>(name, static_cast<uint32_t>(SIZE));
+                if (m_sharedMemory->valid()) {
+                    RingHeader *header = new (m_sharedMemory->data()) RingHeader;
+                    header->numberOfSlots = numberOfSlots;
+                    header->slotSize      = slotSize;
+                    header->slotStride    = STRIDE;
+                    header->attached.store(0);
+                    header->writeIndex.store(0);
+                    header->generation.store(0);
+                    header->waiters.store(0);
+                    for (auto &p : header->participants) {
+                        p.owner.store(0);
+                        p.heartbeat.store(0);
+                    }
+                    for (uint32_t i{0}; i < numberOfSlots; i++) {
+                        SlotHeader *slot = new (m_sharedMemory->data() + sizeof(RingHeader) + static_cast<uint64_t>(i) * STRIDE) SlotHeader;
+                        slot->sequence.store(0);
+                        slot->length   = 0;
+                        slot->producer = 0;
+                    }
+                    // Publishing the magic number marks the ring as ready.
+                    header->magic.store(RING_MAGIC);
+                }
+            }
+        }
+    }
+
+    if (m_sharedMemory && m_sharedMemory->valid()) {
+        RingHeader *header = reinterpret_cast<RingHeader *>(m_sharedMemory->data());
+        // Allow a concurrently creating process to finish the initialization.
+        for (uint32_t i{0}; (i < 100) && (RING_MAGIC != header->magic.load()); i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if ((RING_MAGIC == header->magic.load())
+            && (m_sharedMemory->size() >= sizeof(RingHeader) + static_cast<uint64_t>(header->numberOfSlots) * header->slotStride)) {
+            uint32_t attached{header->attached.load()};
+            do {
+                if (CLOSED == (attached & CLOSED)) {
+                    if (!replaceClosedRing) {
+                        m_sharedMemory.reset(nullptr);
+                        return false;
+                    }
+                    // The last subscriber did not finish removing the ring; replace it.
+                    m_sharedMemory->removeOnDestruction(true);
+                    m_sharedMemory.reset(nullptr);
+                    attach(name, numberOfSlots, slotSize, false);
+                    return true;
+                }
+            } while (!header->attached.compare_exchange_weak(attached, attached + 1));
+            // The ring outlives the instance that created it; the last subscriber removes it.
+            m_sharedMemory->removeOnDestruction(false);
+
+            m_header        = header;
+            m_slots         = m_sharedMemory->data() + sizeof(RingHeader);
+            m_numberOfSlots = header->numberOfSlots;
+            m_slotSize      = header->slotSize;
+            // New subscribers start with the next entry to be written.
+            m_cursor = header->writeIndex.load();
+        }
+    }
+    return true;
+}
+
+SharedMemoryRing::~SharedMemoryRing() noexcept {
+    if (nullptr != m_header) {
+        // Wake up all waiting subscribers as the ring might be removed.
+        wakeUp();
+
+        // The last subscriber closes the ring so that processes attaching
+        // concurrently create a new one instead of using the removed one.
+        uint32_t attached{m_header->attached.load()};
+        while (!m_header->attached.compare_exchange_weak(attached, (1 == attached) ? CLOSED : attached - 1)) {}
+        if (1 == attached) {
+            m_sharedMemory->removeOnDestruction(true);
+        }
+    }
+    m_header = nullptr;
+    m_slots  = nullptr;
+    m_sharedMemory.reset(nullptr);
+}
+
+bool SharedMemoryRing::valid() noexcept {
+    return (nullptr != m_header) && m_sharedMemory && m_sharedMemory->valid();
+}
+
+uint32_t SharedMemoryRing::numberOfSlots() const noexcept {
+    return m_numberOfSlots;
+}
+
+uint32_t SharedMemoryRing::slotSize() const noexcept {
+    return m_slotSize;
+}
+
+int32_t SharedMemoryRing::producer() const noexcept {
+    return m_producer;
+}
+
+uint64_t SharedMemoryRing::missed() const noexcept {
+    return m_missed;
+}
+
+bool SharedMemoryRing::push(const std::string &data) noexcept {
+    if ((nullptr == m_header) || (data.size() > m_slotSize)) {
+        return false;
+    }
+
+    const uint64_t INDEX{m_header->writeIndex.fetch_add(1)};
+    SlotHeader *slot = reinterpret_cast<SlotHeader *>(m_slots + (INDEX % m_numberOfSlots) * m_header->slotStride);
+
+    // Mark the slot as being written unless a producer that is already one
+    // lap ahead has claimed it in the meantime.
+    const uint64_t WRITING{2 * INDEX + 1};
+    uint64_t current{slot->sequence.load()};
+    do {
+        if (current > WRITING) {
+            return true; // Our entry has already been overwritten in the ring.
+        }
+    } while (!slot->sequence.compare_exchange_weak(current, WRITING));
+
+    slot->length   = static_cast<uint32_t>(data.size());
+    slot->producer = processIdentifier();
+    std::memcpy(reinterpret_cast<char *>(slot) + sizeof(SlotHeader), data.data(), data.size());
+
+    // Commit only if no other producer took over the slot.
+    uint64_t expected{WRITING};
+    slot->sequence.compare_exchange_strong(expected, WRITING + 1);
+
+    wakeUp();
+    return true;
+}
+
+bool SharedMemoryRing::pop(std::string &data, std::chrono::microseconds timeout) noexcept {
+    if (nullptr == m_header) {
+        return false;
+    }
+
+    const auto START{std::chrono::steady_clock::now()};
+    if (START - m_lastHeartbeat > HEARTBEAT_INTERVAL) {
+        heartbeat();
+    }
+
+    const auto DEADLINE{START + timeout};
+    while (true) {
+        const uint32_t GENERATION{m_header->generation.load()};
+        const uint64_t WRITE_INDEX{m_header->writeIndex.load()};
+
+        if (m_cursor < WRITE_INDEX) {
+            // Skip all entries that have been overwritten already.
+            if (WRITE_INDEX - m_cursor > m_numberOfSlots) {
+                m_missed += (WRITE_INDEX - m_numberOfSlots) - m_cursor;
+                m_cursor = WRITE_INDEX - m_numberOfSlots;
+            }
+
+            SlotHeader *slot = reinterpret_cast<SlotHeader *>(m_slots + (m_cursor % m_numberOfSlots) * m_header->slotStride);
+            const uint64_t COMMITTED{2 * m_cursor + 2};
+            const uint64_t BEFORE{slot->sequence.load()};
+            if (COMMITTED == BEFORE) {
+                const uint32_t LENGTH{(slot->length > m_slotSize) ? m_slotSize : slot->length};
+                const int32_t PRODUCER{slot->producer};
+                data.assign(reinterpret_cast<const char *>(slot) + sizeof(SlotHeader), LENGTH);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                const uint64_t AFTER{slot->sequence.load()};
+                m_cursor++;
+                m_stalled = false;
+                if (BEFORE == AFTER) {
+                    m_producer = PRODUCER;
+                    return true;
+                }
+                m_missed++; // Torn read as the entry was overwritten while copying.
+                continue;
+            } else if (BEFORE > COMMITTED) {
+                m_missed++; // Already overwritten by a newer entry.
+                m_cursor++;
+                m_stalled = false;
+                continue;
+            }
+
+            // The entry is still being written; skip it if its producer does not finish in time.
+            const auto NOW{std::chrono::steady_clock::now()};
+            if (!m_stalled) {
+                m_stalled      = true;
+                m_stalledSince = NOW;
+            } else if (NOW - m_stalledSince > STALL_LIMIT) {
+                m_missed++;
+                m_cursor++;
+                m_stalled = false;
+                continue;
+            }
+            if (NOW >= DEADLINE) {
+                return false;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+
+        const auto NOW{std::chrono::steady_clock::now()};
+        if (NOW >= DEADLINE) {
+            return false;
+        }
+        if (NOW - m_lastHeartbeat > HEARTBEAT_INTERVAL) {
+            heartbeat();
+        }
+        // Wake up in time for the next heartbeat.
+        const auto TIMEOUT{((DEADLINE - NOW) < HEARTBEAT_INTERVAL) ? (DEADLINE - NOW) : std::chrono::steady_clock::duration(HEARTBEAT_INTERVAL)};
+        waitForNewEntries(GENERATION, std::chrono::duration_cast<std::chrono::microseconds>(TIMEOUT));
+    }
+}
+
+void SharedMemoryRing::wakeUp() noexcept {
+    m_header->generation.fetch_add(1);
+    if (0 < m_header->waiters.load()) {
+#ifdef __linux__
+        ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&(m_header->generation)), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+    }
+}
+
+void SharedMemoryRing::waitForNewEntries(uint32_t generation, std::chrono::microseconds timeout) noexcept {
+    m_header->waiters.fetch_add(1);
+    if ((generation == m_header->generation.load()) && (m_cursor >= m_header->writeIndex.load())) {
+#ifdef __linux__
+        struct timespec ts {};
+        ts.tv_sec  = static_cast<time_t>(timeout.count() / 1000000);
+        ts.tv_nsec = static_cast<long>((timeout.count() % 1000000) * 1000);
+        ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&(m_header->generation)), FUTEX_WAIT, generation, &ts, nullptr, 0);
+#else
+        const std::chrono::microseconds POLLING{1000};
+        std::this_thread::sleep_for((timeout < POLLING) ? timeout : POLLING);
+#endif
+    }
+    m_header->waiters.fetch_sub(1);
+}
+
+bool SharedMemoryRing::addParticipant(uint16_t id) noexcept {
+    if ((nullptr != m_header) && (0 < id)) {
+        const uint64_t OWNER{participantOwner(id)};
+        const int64_t NOW{cluon::time::toMicroseconds(cluon::time::now())};
+        for (auto &p : m_header->participants) {
+            uint64_t expected{p.owner.load()};
+            int64_t lastHeartbeat{p.heartbeat.load()};
+            // Claim unused entries or entries of participants that stopped their heartbeat.
+            if ((0 == expected) || (PARTICIPANT_TIMEOUT < NOW - lastHeartbeat)) {
+                // Refreshing the heartbeat first lets concurrent participants skip the dead entry.
+                if (p.heartbeat.compare_exchange_strong(lastHeartbeat, NOW) && p.owner.compare_exchange_strong(expected, OWNER)) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+void SharedMemoryRing::removeParticipant(uint16_t id) noexcept {
+    if ((nullptr != m_header) && (0 < id)) {
+        const uint64_t OWNER{participantOwner(id)};
+        for (auto &p : m_header->participants) {
+            uint64_t expected{OWNER};
+            if (p.owner.compare_exchange_strong(expected, 0)) {
+                return;
+            }
+        }
+    }
+}
+
+bool SharedMemoryRing::isParticipant(uint16_t id) noexcept {
+    if ((nullptr != m_header) && (0 < id)) {
+        for (auto &p : m_header->participants) {
+            uint64_t owner{p.owner.load()};
+            if ((0 != owner) && (id == static_cast<uint16_t>(owner & 0xFFFF))) {
+                if (cluon::time::toMicroseconds(cluon::time::now()) - p.heartbeat.load() <= PARTICIPANT_TIMEOUT) {
+                    return true;
+                }
+                // Remove the entry of a dead participant as its port might be reused by an unrelated process.
+                p.owner.compare_exchange_strong(owner, 0);
+            }
+        }
+    }
+    return false;
+}
+
+void SharedMemoryRing::heartbeat() noexcept {
+    if (nullptr != m_header) {
+        const uint64_t PID{static_cast<uint32_t>(processIdentifier())};
+        const int64_t NOW{cluon::time::toMicroseconds(cluon::time::now())};
+        for (auto &p : m_header->participants) {
+            if (PID == (p.owner.load(std::memory_order_relaxed) >> 16)) {
+                p.heartbeat.store(NOW, std::memory_order_relaxed);
+            }
+        }
+        m_lastHeartbeat = std::chrono::steady_clock::now();
+    }
+}
+
+} // namespace cluon
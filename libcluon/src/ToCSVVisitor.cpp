@@ -57,7 +57,7 @@ void ToCSVVisitor::postVisit() noexcept {
     m_bufferValues << (m_isNested ? "" : "\n");
 }
 
-void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void ToCSVVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         if (m_fillHeader) {
@@ -67,7 +67,7 @@ void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     }
 }
 
-void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void ToCSVVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         if (m_fillHeader) {
@@ -77,7 +77,7 @@ void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     }
 }
 
-void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void ToCSVVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         if (m_fillHeader) {
@@ -87,7 +87,7 @@ void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     }
 }
 
-void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void ToCSVVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         if (m_fillHeader) {
@@ -97,7 +97,7 @@ void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     }
 }
 
-void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void ToCSVVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         if (m_fillHeader) {
@@ -107,7 +107,7 @@ void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     }
 }
 
-void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void ToCSVVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         if (m_fillHeader) {
@@ -117,7 +117,7 @@ void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     }
 }
 
-void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void ToCSVVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         if (m_fillHeader) {
@@ -127,7 +127,7 @@ void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     }
 }
 
-void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void ToCSVVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         if (m_fillHeader) {
@@ -137,7 +137,7 @@ void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     }
 }
 
-void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void ToCSVVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         if (m_fillHeader) {
@@ -147,7 +147,7 @@ void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     }
 }
 
-void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void ToCSVVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         if (m_fillHeader) {
@@ -157,7 +157,7 @@ void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     }
 }
 
-void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void ToCSVVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         if (m_fillHeader) {
@@ -167,7 +167,7 @@ void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     }
 }
 
-void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void ToCSVVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         if (m_fillHeader) {
@@ -177,7 +177,7 @@ void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     }
 }
 
-void ToCSVVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void ToCSVVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         if (m_fillHeader) {
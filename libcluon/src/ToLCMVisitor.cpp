@@ -39,7 +39,7 @@ void ToLCMVisitor::preVisit(int32_t id, const std::string &shortName, const std:
 
 void ToLCMVisitor::postVisit() noexcept {}
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -48,7 +48,7 @@ void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     m_buffer.write(reinterpret_cast<char *>(&v), sizeof(bool));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -57,7 +57,7 @@ void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     m_buffer.write(reinterpret_cast<char *>(&v), sizeof(char));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -66,7 +66,7 @@ void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     m_buffer.write(reinterpret_cast<char *>(&v), sizeof(int8_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -75,7 +75,7 @@ void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     m_buffer.write(reinterpret_cast<char *>(&v), sizeof(uint8_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -85,7 +85,7 @@ void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int16_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -95,7 +95,7 @@ void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int16_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -105,7 +105,7 @@ void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int32_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -115,7 +115,7 @@ void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int32_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -125,7 +125,7 @@ void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int64_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -135,7 +135,7 @@ void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int64_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -147,7 +147,7 @@ void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int32_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
@@ -159,7 +159,7 @@ void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int64_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
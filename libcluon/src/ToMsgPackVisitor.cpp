@@ -134,7 +134,7 @@ void ToMsgPackVisitor::preVisit(int32_t id, const std::string &shortName, const
 
 void ToMsgPackVisitor::postVisit() noexcept {}
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -144,7 +144,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -154,7 +154,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -163,7 +163,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -172,7 +172,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -181,7 +181,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -190,7 +190,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -199,7 +199,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -208,7 +208,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -217,7 +217,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -226,7 +226,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -240,7 +240,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -254,7 +254,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)id;
     (void)typeName;
 
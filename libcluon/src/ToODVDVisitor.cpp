@@ -30,7 +30,7 @@ void ToODVDVisitor::postVisit() noexcept {
     m_buffer << '}' << '\n';
 }
 
-void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void ToODVDVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)typeName;
     (void)v;
     m_buffer << "    "
@@ -38,7 +38,7 @@ void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&nam
              << " " << name << " [ default = false, id = " << id << " ];" << '\n';
 }
 
-void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void ToODVDVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)typeName;
     (void)v;
     m_buffer << "    "
@@ -46,7 +46,7 @@ void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&nam
              << " " << name << " [ default = '0', id = " << id << " ];" << '\n';
 }
 
-void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void ToODVDVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)typeName;
     (void)v;
     m_buffer << "    "
@@ -54,7 +54,7 @@ void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&nam
              << " " << name << " [ default = 0, id = " << id << " ];" << '\n';
 }
 
-void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void ToODVDVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)typeName;
     (void)v;
     m_buffer << "    "
@@ -62,7 +62,7 @@ void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&nam
              << " " << name << " [ default = 0, id = " << id << " ];" << '\n';
 }
 
-void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void ToODVDVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)typeName;
     (void)v;
     m_buffer << "    "
@@ -70,7 +70,7 @@ void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&nam
              << " " << name << " [ default = 0, id = " << id << " ];" << '\n';
 }
 
-void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void ToODVDVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)typeName;
     (void)v;
     m_buffer << "    "
@@ -78,7 +78,7 @@ void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&nam
              << " " << name << " [ default = 0, id = " << id << " ];" << '\n';
 }
 
-void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void ToODVDVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)typeName;
     (void)v;
     m_buffer << "    "
@@ -86,7 +86,7 @@ void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&nam
              << " " << name << " [ default = 0, id = " << id << " ];" << '\n';
 }
 
-void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void ToODVDVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)typeName;
     (void)v;
     m_buffer << "    "
@@ -94,7 +94,7 @@ void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&nam
              << " " << name << " [ default = 0, id = " << id << " ];" << '\n';
 }
 
-void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void ToODVDVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)typeName;
     (void)v;
     m_buffer << "    "
@@ -102,7 +102,7 @@ void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&nam
              << " " << name << " [ default = 0, id = " << id << " ];" << '\n';
 }
 
-void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void ToODVDVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)typeName;
     (void)v;
     m_buffer << "    "
@@ -110,7 +110,7 @@ void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&nam
              << " " << name << " [ default = 0, id = " << id << " ];" << '\n';
 }
 
-void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void ToODVDVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)typeName;
     (void)v;
     m_buffer << "    "
@@ -118,7 +118,7 @@ void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&nam
              << " " << name << " [ default = 0.0, id = " << id << " ];" << '\n';
 }
 
-void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void ToODVDVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)typeName;
     (void)v;
     m_buffer << "    "
@@ -126,7 +126,7 @@ void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&nam
              << " " << name << " [ default = 0.0, id = " << id << " ];" << '\n';
 }
 
-void ToODVDVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void ToODVDVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)typeName;
     (void)v;
     m_buffer << "    "
@@ -23,6 +23,7 @@
     #include <iostream>
 #else
     #ifdef __linux__
+        #include <linux/filter.h>
         #include <linux/sockios.h>
     #endif
 
@@ -40,6 +41,7 @@
 #endif
 // clang-format on
 
+#include <cerrno>
 #include <cstring>
 #include <algorithm>
 #include <array>
@@ -366,6 +368,27 @@ bool UDPReceiver::isRunning() const noexcept {
     return (m_readFromSocketThreadRunning.load() && !TerminateHandler::instance().isTerminated.load());
 }
 
+bool UDPReceiver::setSocketFilter(const std::vector<FilterInstruction> &program) noexcept {
+    bool retVal{false};
+#ifdef __linux__
+    static_assert(sizeof(FilterInstruction) == sizeof(struct sock_filter), "FilterInstruction must match struct sock_filter.");
+    if (!(m_socket < 0)) {
+        if (program.empty()) {
+            int32_t dummy{0};
+            retVal = (0 == ::setsockopt(m_socket, SOL_SOCKET, SO_DETACH_FILTER, &dummy, sizeof(dummy))) || (ENOENT == errno);
+        } else if (program.size() <= BPF_MAXINSNS) {
+            struct sock_fprog fprog {};
+            fprog.len    = static_cast<uint16_t>(program.size());
+            fprog.filter = reinterpret_cast<struct sock_filter *>(const_cast<FilterInstruction *>(program.data())); // NOLINT
+            retVal       = (0 == ::setsockopt(m_socket, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog)));
+        }
+    }
+#else
+    (void)program;
+#endif
+    return retVal;
+}
+
 void UDPReceiver::readFromSocket() noexcept {
     // Create buffer to store data from socket.
     constexpr uint16_t MAX_LENGTH = static_cast<uint16_t>(UDPPacketSizeConstraints::MAX_SIZE_UDP_PACKET)
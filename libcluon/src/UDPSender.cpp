@@ -15,6 +15,7 @@
     #include <arpa/inet.h>
     #include <ifaddrs.h>
     #include <netdb.h>
+    #include <netinet/in.h>
     #include <sys/socket.h>
     #include <sys/types.h>
     #include <unistd.h>
@@ -161,6 +162,26 @@ uint16_t UDPSender::getSendFromPort() const noexcept {
 }
 
 std::pair<ssize_t, int32_t> UDPSender::send(std::string &&data) const noexcept {
+    return send(std::move(data), 0);
+}
+
+std::pair<ssize_t, int32_t> UDPSender::send(std::string &&data, uint8_t dscp) const noexcept {
+    return sendTo(std::move(data), m_sendToAddress, dscp);
+}
+
+std::pair<ssize_t, int32_t> UDPSender::sendTo(std::string &&data, const std::string &sendToAddress, uint16_t sendToPort, uint8_t dscp) const noexcept {
+    struct sockaddr_in address {};
+    std::memset(&address, 0, sizeof(address));
+    address.sin_addr.s_addr = ::inet_addr(sendToAddress.c_str());
+    address.sin_family      = AF_INET;
+    address.sin_port        = htons(sendToPort);
+    if ((INADDR_NONE == address.sin_addr.s_addr) || (0 == sendToPort)) {
+        return {-1, EINVAL};
+    }
+    return sendTo(std::move(data), address, dscp);
+}
+
+std::pair<ssize_t, int32_t> UDPSender::sendTo(std::string &&data, const struct sockaddr_in &sendToAddress, uint8_t dscp) const noexcept {
     if (-1 == m_socket) {
         return {-1, EBADF};
     }
@@ -177,12 +198,32 @@ std::pair<ssize_t, int32_t> UDPSender::send(std::string &&data) const noexcept {
     }
 
     std::lock_guard<std::mutex> lck(m_socketMutex);
+#ifndef WIN32
+    // The socket options are only changed when the marking differs from the previous datagram.
+    dscp = static_cast<uint8_t>(dscp & 0x3F);
+    if (dscp != m_dscp) {
+        int32_t tos = (dscp << 2);
+        if (0 > ::setsockopt(m_socket, IPPROTO_IP, IP_TOS, reinterpret_cast<char *>(&tos), sizeof(tos))) { // NOLINT
+            return {-1, errno}; // LCOV_EXCL_LINE
+        }
+#ifdef SO_PRIORITY
+        // Setting IP_TOS overwrites the socket priority; 6 is the highest priority for unprivileged processes.
+        int32_t priority = (0 < dscp ? 6 : 0);
+        if (0 > ::setsockopt(m_socket, SOL_SOCKET, SO_PRIORITY, reinterpret_cast<char *>(&priority), sizeof(priority))) { // NOLINT
+            return {-1, errno}; // LCOV_EXCL_LINE
+        }
+#endif
+        m_dscp = dscp;
+    }
+#else
+    (void)dscp;
+#endif
     ssize_t bytesSent = ::sendto(m_socket,
                                  data.c_str(),
                                  data.length(),
                                  0,
-                                 reinterpret_cast<const struct sockaddr *>(&m_sendToAddress), // NOLINT
-                                 sizeof(m_sendToAddress));
+                                 reinterpret_cast<const struct sockaddr *>(&sendToAddress), // NOLINT
+                                 sizeof(sendToAddress));
 
     return {bytesSent, (0 > bytesSent ? errno : 0)};
 }
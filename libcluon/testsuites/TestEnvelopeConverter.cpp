@@ -1037,6 +1037,14 @@ message MyTestMessage5 [id = 30005] {
     cluon::data::Envelope env;
     REQUIRE(0 == env.dataType());
 
+    // Reading back the Envelope directly from memory yields the same Envelope.
+    auto retVal2 = cluon::extractEnvelope(protoEncodedData.data(), protoEncodedData.size());
+    REQUIRE(retVal2.first);
+    REQUIRE(retVal.second.dataType() == retVal2.second.dataType());
+    REQUIRE(retVal.second.serializedData() == retVal2.second.serializedData());
+    REQUIRE(!cluon::extractEnvelope(protoEncodedData.data(), protoEncodedData.size() - 1).first);
+    REQUIRE(!cluon::extractEnvelope(protoEncodedData.data() + 1, protoEncodedData.size() - 1).first);
+
     // Verify values in transformed Envelope.
     env = retVal.second;
     REQUIRE(MESSAGE_IDENTIFIER == env.dataType());
@@ -1530,3 +1538,49 @@ message MyTestMessage5 [id = 30009] {
     REQUIRE(tmp2.attribute10() == Approx(tmp.attribute10()));
     REQUIRE(tmp2.attribute11() == tmp.attribute11());
 }
+
+TEST_CASE("Serialize and extract Envelope with optional sequence number.") {
+    cluon::data::TimeStamp ts;
+    ts.seconds(1).microseconds(2);
+
+    cluon::data::Envelope env;
+    env.dataType(12).senderStamp(3).sent(ts);
+
+    // Envelopes without sequence number are encoded as before.
+    const std::string WITHOUT{cluon::serializeEnvelope(cluon::data::Envelope{env})};
+    REQUIRE(WITHOUT == cluon::serializeEnvelope(cluon::data::Envelope{env}, 0, 1234));
+
+    const std::string WITH{cluon::serializeEnvelope(cluon::data::Envelope{env}, 300, 0xABCDEF01)};
+    REQUIRE(WITHOUT.size() < WITH.size());
+
+    {
+        std::stringstream sstr(WITH);
+        uint32_t sequenceNumber{0};
+        uint32_t sourceIdentifier{0};
+        auto retVal = cluon::extractEnvelope(sstr, sequenceNumber, sourceIdentifier);
+        REQUIRE(retVal.first);
+        REQUIRE(12 == retVal.second.dataType());
+        REQUIRE(3 == retVal.second.senderStamp());
+        REQUIRE(2 == retVal.second.sent().microseconds());
+        REQUIRE(300 == sequenceNumber);
+        REQUIRE(0xABCDEF01 == sourceIdentifier);
+    }
+    {
+        // Decoders unaware of the sequence number skip it.
+        std::stringstream sstr(WITH);
+        auto retVal = cluon::extractEnvelope(sstr);
+        REQUIRE(retVal.first);
+        REQUIRE(12 == retVal.second.dataType());
+        REQUIRE(3 == retVal.second.senderStamp());
+        REQUIRE(2 == retVal.second.sent().microseconds());
+    }
+    {
+        std::stringstream sstr(WITHOUT);
+        uint32_t sequenceNumber{1};
+        uint32_t sourceIdentifier{1};
+        auto retVal = cluon::extractEnvelope(sstr, sequenceNumber, sourceIdentifier);
+        REQUIRE(retVal.first);
+        REQUIRE(0 == sequenceNumber);
+        REQUIRE(0 == sourceIdentifier);
+    }
+}
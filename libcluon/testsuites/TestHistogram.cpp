@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon/Histogram.hpp"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Testing empty Histogram.") {
+    cluon::Histogram h;
+    REQUIRE(0 == h.count());
+    REQUIRE(0 == h.min());
+    REQUIRE(0 == h.max());
+    REQUIRE(0.0 == Approx(h.mean()));
+    REQUIRE(0 == h.percentile(50.0));
+}
+
+TEST_CASE("Testing Histogram with exactly recorded small values.") {
+    cluon::Histogram h;
+    for (int64_t i{1}; i <= 20; i++) { h.record(i); }
+    h.record(-5);
+
+    REQUIRE(21 == h.count());
+    REQUIRE(0 == h.min());
+    REQUIRE(20 == h.max());
+    REQUIRE(10.0 == Approx(h.mean()));
+    REQUIRE(0 == h.percentile(0.0));
+    REQUIRE(10 == h.percentile(50.0));
+    REQUIRE(20 == h.percentile(100.0));
+    REQUIRE(20 == h.percentile(200.0));
+
+    h.reset();
+    REQUIRE(0 == h.count());
+    REQUIRE(0 == h.max());
+    REQUIRE(0 == h.percentile(50.0));
+}
+
+TEST_CASE("Testing Histogram precision for large values.") {
+    cluon::Histogram h;
+    for (int64_t i{1}; i <= 100000; i++) { h.record(i * 10); }
+    REQUIRE(100000 == h.count());
+    REQUIRE(10 == h.min());
+    REQUIRE(1000000 == h.max());
+
+    const int64_t P50{h.percentile(50.0)};
+    REQUIRE(500000 <= P50);
+    REQUIRE(P50 <= 500000 + 500000 / 16);
+
+    const int64_t P99{h.percentile(99.0)};
+    REQUIRE(990000 <= P99);
+    REQUIRE(P99 <= 1000000);
+
+    h.record(INT64_MAX);
+    REQUIRE(INT64_MAX == h.max());
+    REQUIRE(INT64_MAX == h.percentile(100.0));
+}
+
+TEST_CASE("Testing Histogram with concurrent recording.") {
+    cluon::Histogram h;
+    std::vector<std::thread> threads;
+    for (int32_t t{0}; t < 4; t++) {
+        threads.emplace_back([&h]() noexcept {
+            for (int64_t i{0}; i < 10000; i++) { h.record(i); }
+        });
+    }
+    for (auto &t : threads) { t.join(); }
+    REQUIRE(40000 == h.count());
+    REQUIRE(0 == h.min());
+    REQUIRE(9999 == h.max());
+}
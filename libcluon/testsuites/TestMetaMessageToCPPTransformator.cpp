@@ -56,16 +56,16 @@ message MyMessage1 [id = 1] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -74,9 +74,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -89,17 +95,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -113,9 +119,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -153,11 +165,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -184,7 +198,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -193,7 +207,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
@@ -201,7 +215,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -257,16 +271,16 @@ message MyMessage2 [id = 2] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -275,9 +289,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -290,17 +310,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -314,9 +334,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -354,11 +380,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -385,7 +413,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -394,7 +422,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
@@ -402,7 +430,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -436,16 +464,16 @@ struct isTripletForwardVisitable<MyMessage1> {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -454,9 +482,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -469,17 +503,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -493,9 +527,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -533,11 +573,13 @@ class LIB_API MyMessage2 {
         inline static int32_t ID() {
             return 2;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -564,7 +606,7 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -573,7 +615,7 @@ class LIB_API MyMessage2 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
@@ -581,7 +623,7 @@ class LIB_API MyMessage2 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -646,16 +688,16 @@ message MyPackage.MyMessage2 [id = 2] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -664,9 +706,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -679,17 +727,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -703,9 +751,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -743,11 +797,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -774,7 +830,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -783,7 +839,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
@@ -791,7 +847,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -825,16 +881,16 @@ struct isTripletForwardVisitable<MyPackage::MyMessage1> {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -843,9 +899,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -858,17 +920,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -882,9 +944,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -922,11 +990,13 @@ class LIB_API MyMessage2 {
         inline static int32_t ID() {
             return 2;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -953,7 +1023,7 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -962,7 +1032,7 @@ class LIB_API MyMessage2 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
@@ -970,7 +1040,7 @@ class LIB_API MyMessage2 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -1036,16 +1106,16 @@ message MyMessage2 [id = 2] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -1054,9 +1124,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -1069,17 +1145,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -1093,9 +1169,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -1133,11 +1215,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -1164,7 +1248,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -1173,7 +1257,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
@@ -1181,7 +1265,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -1215,16 +1299,16 @@ struct isTripletForwardVisitable<MyPackage::MyMessage1> {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -1233,9 +1317,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -1248,17 +1338,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -1272,9 +1362,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -1312,11 +1408,13 @@ class LIB_API MyMessage2 {
         inline static int32_t ID() {
             return 2;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -1343,7 +1441,7 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -1352,7 +1450,7 @@ class LIB_API MyMessage2 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
@@ -1360,7 +1458,7 @@ class LIB_API MyMessage2 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -1426,16 +1524,16 @@ message MyMessage2 [id = 2] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -1444,9 +1542,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -1459,17 +1563,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -1483,9 +1587,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -1523,11 +1633,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -1554,7 +1666,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -1563,7 +1675,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
@@ -1571,7 +1683,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -1605,16 +1717,16 @@ struct isTripletForwardVisitable<MyPackage::SubPackage::MyMessage1> {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -1623,9 +1735,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -1638,17 +1756,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -1662,9 +1780,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -1702,11 +1826,13 @@ class LIB_API MyMessage2 {
         inline static int32_t ID() {
             return 2;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -1733,7 +1859,7 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -1742,7 +1868,7 @@ class LIB_API MyMessage2 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
@@ -1750,7 +1876,7 @@ class LIB_API MyMessage2 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -1812,16 +1938,16 @@ message MyMessage1 [id = 1] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -1830,9 +1956,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -1845,17 +1977,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -1869,9 +2001,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -1909,11 +2047,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -1940,7 +2080,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -1949,7 +2089,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
@@ -1957,7 +2097,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -2010,16 +2150,16 @@ message MyMessage1 [id = 1] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -2028,9 +2168,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -2043,17 +2189,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -2067,9 +2213,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -2107,11 +2259,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -2138,7 +2292,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -2147,7 +2301,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
@@ -2155,7 +2309,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -2208,16 +2362,16 @@ message MySubPackageMessage.MyMessage1 [id = 1] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -2226,9 +2380,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -2241,17 +2401,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -2265,9 +2425,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -2305,11 +2471,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -2336,7 +2504,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -2345,7 +2513,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
@@ -2353,7 +2521,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -2407,16 +2575,16 @@ message MySubPackageMessage.MyMessage1 [id = 1] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -2425,9 +2593,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -2440,17 +2614,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -2464,9 +2638,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -2504,11 +2684,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -2535,7 +2717,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -2544,7 +2726,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
@@ -2552,7 +2734,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -2610,16 +2792,16 @@ message MyMessage1 [id = 1] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -2628,9 +2810,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -2643,17 +2831,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -2667,9 +2855,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -2707,11 +2901,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -2780,31 +2976,31 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("bool"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "bool", "attribute1", m_attribute1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("char"s), std::move("attribute2"s), m_attribute2, visitor);
+                doVisit(2, "char", "attribute2", m_attribute2, visitor);
                 return;
             }
             if (3 == fieldId) {
-                doVisit(3, std::move("int32_t"s), std::move("attribute3"s), m_attribute3, visitor);
+                doVisit(3, "int32_t", "attribute3", m_attribute3, visitor);
                 return;
             }
             if (4 == fieldId) {
-                doVisit(4, std::move("uint32_t"s), std::move("attribute4"s), m_attribute4, visitor);
+                doVisit(4, "uint32_t", "attribute4", m_attribute4, visitor);
                 return;
             }
             if (5 == fieldId) {
-                doVisit(5, std::move("float"s), std::move("attribute5"s), m_attribute5, visitor);
+                doVisit(5, "float", "attribute5", m_attribute5, visitor);
                 return;
             }
             if (6 == fieldId) {
-                doVisit(6, std::move("double"s), std::move("attribute6"s), m_attribute6, visitor);
+                doVisit(6, "double", "attribute6", m_attribute6, visitor);
                 return;
             }
             if (7 == fieldId) {
-                doVisit(7, std::move("std::string"s), std::move("attribute7"s), m_attribute7, visitor);
+                doVisit(7, "std::string", "attribute7", m_attribute7, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -2813,13 +3009,13 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("bool"s), std::move("attribute1"s), m_attribute1, visitor);
-            doVisit(2, std::move("char"s), std::move("attribute2"s), m_attribute2, visitor);
-            doVisit(3, std::move("int32_t"s), std::move("attribute3"s), m_attribute3, visitor);
-            doVisit(4, std::move("uint32_t"s), std::move("attribute4"s), m_attribute4, visitor);
-            doVisit(5, std::move("float"s), std::move("attribute5"s), m_attribute5, visitor);
-            doVisit(6, std::move("double"s), std::move("attribute6"s), m_attribute6, visitor);
-            doVisit(7, std::move("std::string"s), std::move("attribute7"s), m_attribute7, visitor);
+            doVisit(1, "bool", "attribute1", m_attribute1, visitor);
+            doVisit(2, "char", "attribute2", m_attribute2, visitor);
+            doVisit(3, "int32_t", "attribute3", m_attribute3, visitor);
+            doVisit(4, "uint32_t", "attribute4", m_attribute4, visitor);
+            doVisit(5, "float", "attribute5", m_attribute5, visitor);
+            doVisit(6, "double", "attribute6", m_attribute6, visitor);
+            doVisit(7, "std::string", "attribute7", m_attribute7, visitor);
             visitor.postVisit();
         }
 
@@ -2827,13 +3023,13 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("bool"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("char"s), std::move("attribute2"s), m_attribute2, preVisit, visit, postVisit);
-            doTripletForwardVisit(3, std::move("int32_t"s), std::move("attribute3"s), m_attribute3, preVisit, visit, postVisit);
-            doTripletForwardVisit(4, std::move("uint32_t"s), std::move("attribute4"s), m_attribute4, preVisit, visit, postVisit);
-            doTripletForwardVisit(5, std::move("float"s), std::move("attribute5"s), m_attribute5, preVisit, visit, postVisit);
-            doTripletForwardVisit(6, std::move("double"s), std::move("attribute6"s), m_attribute6, preVisit, visit, postVisit);
-            doTripletForwardVisit(7, std::move("std::string"s), std::move("attribute7"s), m_attribute7, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "bool", "attribute1", m_attribute1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "char", "attribute2", m_attribute2, preVisit, visit, postVisit);
+            doTripletForwardVisit(3, "int32_t", "attribute3", m_attribute3, preVisit, visit, postVisit);
+            doTripletForwardVisit(4, "uint32_t", "attribute4", m_attribute4, preVisit, visit, postVisit);
+            doTripletForwardVisit(5, "float", "attribute5", m_attribute5, preVisit, visit, postVisit);
+            doTripletForwardVisit(6, "double", "attribute6", m_attribute6, preVisit, visit, postVisit);
+            doTripletForwardVisit(7, "std::string", "attribute7", m_attribute7, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -2904,16 +3100,16 @@ message MyMessage1 [id = 1] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -2922,9 +3118,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -2937,17 +3139,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -2961,9 +3163,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -3001,11 +3209,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -3123,59 +3333,59 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("bool"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "bool", "attribute1", m_attribute1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("char"s), std::move("attribute2"s), m_attribute2, visitor);
+                doVisit(2, "char", "attribute2", m_attribute2, visitor);
                 return;
             }
             if (3 == fieldId) {
-                doVisit(3, std::move("int8_t"s), std::move("attribute3"s), m_attribute3, visitor);
+                doVisit(3, "int8_t", "attribute3", m_attribute3, visitor);
                 return;
             }
             if (4 == fieldId) {
-                doVisit(4, std::move("uint8_t"s), std::move("attribute4"s), m_attribute4, visitor);
+                doVisit(4, "uint8_t", "attribute4", m_attribute4, visitor);
                 return;
             }
             if (5 == fieldId) {
-                doVisit(5, std::move("int16_t"s), std::move("attribute5"s), m_attribute5, visitor);
+                doVisit(5, "int16_t", "attribute5", m_attribute5, visitor);
                 return;
             }
             if (6 == fieldId) {
-                doVisit(6, std::move("uint16_t"s), std::move("attribute6"s), m_attribute6, visitor);
+                doVisit(6, "uint16_t", "attribute6", m_attribute6, visitor);
                 return;
             }
             if (7 == fieldId) {
-                doVisit(7, std::move("int32_t"s), std::move("attribute7"s), m_attribute7, visitor);
+                doVisit(7, "int32_t", "attribute7", m_attribute7, visitor);
                 return;
             }
             if (8 == fieldId) {
-                doVisit(8, std::move("uint32_t"s), std::move("attribute8"s), m_attribute8, visitor);
+                doVisit(8, "uint32_t", "attribute8", m_attribute8, visitor);
                 return;
             }
             if (9 == fieldId) {
-                doVisit(9, std::move("int64_t"s), std::move("attribute9"s), m_attribute9, visitor);
+                doVisit(9, "int64_t", "attribute9", m_attribute9, visitor);
                 return;
             }
             if (10 == fieldId) {
-                doVisit(10, std::move("uint64_t"s), std::move("attribute10"s), m_attribute10, visitor);
+                doVisit(10, "uint64_t", "attribute10", m_attribute10, visitor);
                 return;
             }
             if (11 == fieldId) {
-                doVisit(11, std::move("float"s), std::move("attribute11"s), m_attribute11, visitor);
+                doVisit(11, "float", "attribute11", m_attribute11, visitor);
                 return;
             }
             if (12 == fieldId) {
-                doVisit(12, std::move("double"s), std::move("attribute12"s), m_attribute12, visitor);
+                doVisit(12, "double", "attribute12", m_attribute12, visitor);
                 return;
             }
             if (13 == fieldId) {
-                doVisit(13, std::move("std::string"s), std::move("attribute13"s), m_attribute13, visitor);
+                doVisit(13, "std::string", "attribute13", m_attribute13, visitor);
                 return;
             }
             if (14 == fieldId) {
-                doVisit(14, std::move("std::string"s), std::move("attribute14"s), m_attribute14, visitor);
+                doVisit(14, "std::string", "attribute14", m_attribute14, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -3184,20 +3394,20 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("bool"s), std::move("attribute1"s), m_attribute1, visitor);
-            doVisit(2, std::move("char"s), std::move("attribute2"s), m_attribute2, visitor);
-            doVisit(3, std::move("int8_t"s), std::move("attribute3"s), m_attribute3, visitor);
-            doVisit(4, std::move("uint8_t"s), std::move("attribute4"s), m_attribute4, visitor);
-            doVisit(5, std::move("int16_t"s), std::move("attribute5"s), m_attribute5, visitor);
-            doVisit(6, std::move("uint16_t"s), std::move("attribute6"s), m_attribute6, visitor);
-            doVisit(7, std::move("int32_t"s), std::move("attribute7"s), m_attribute7, visitor);
-            doVisit(8, std::move("uint32_t"s), std::move("attribute8"s), m_attribute8, visitor);
-            doVisit(9, std::move("int64_t"s), std::move("attribute9"s), m_attribute9, visitor);
-            doVisit(10, std::move("uint64_t"s), std::move("attribute10"s), m_attribute10, visitor);
-            doVisit(11, std::move("float"s), std::move("attribute11"s), m_attribute11, visitor);
-            doVisit(12, std::move("double"s), std::move("attribute12"s), m_attribute12, visitor);
-            doVisit(13, std::move("std::string"s), std::move("attribute13"s), m_attribute13, visitor);
-            doVisit(14, std::move("std::string"s), std::move("attribute14"s), m_attribute14, visitor);
+            doVisit(1, "bool", "attribute1", m_attribute1, visitor);
+            doVisit(2, "char", "attribute2", m_attribute2, visitor);
+            doVisit(3, "int8_t", "attribute3", m_attribute3, visitor);
+            doVisit(4, "uint8_t", "attribute4", m_attribute4, visitor);
+            doVisit(5, "int16_t", "attribute5", m_attribute5, visitor);
+            doVisit(6, "uint16_t", "attribute6", m_attribute6, visitor);
+            doVisit(7, "int32_t", "attribute7", m_attribute7, visitor);
+            doVisit(8, "uint32_t", "attribute8", m_attribute8, visitor);
+            doVisit(9, "int64_t", "attribute9", m_attribute9, visitor);
+            doVisit(10, "uint64_t", "attribute10", m_attribute10, visitor);
+            doVisit(11, "float", "attribute11", m_attribute11, visitor);
+            doVisit(12, "double", "attribute12", m_attribute12, visitor);
+            doVisit(13, "std::string", "attribute13", m_attribute13, visitor);
+            doVisit(14, "std::string", "attribute14", m_attribute14, visitor);
             visitor.postVisit();
         }
 
@@ -3205,20 +3415,20 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("bool"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("char"s), std::move("attribute2"s), m_attribute2, preVisit, visit, postVisit);
-            doTripletForwardVisit(3, std::move("int8_t"s), std::move("attribute3"s), m_attribute3, preVisit, visit, postVisit);
-            doTripletForwardVisit(4, std::move("uint8_t"s), std::move("attribute4"s), m_attribute4, preVisit, visit, postVisit);
-            doTripletForwardVisit(5, std::move("int16_t"s), std::move("attribute5"s), m_attribute5, preVisit, visit, postVisit);
-            doTripletForwardVisit(6, std::move("uint16_t"s), std::move("attribute6"s), m_attribute6, preVisit, visit, postVisit);
-            doTripletForwardVisit(7, std::move("int32_t"s), std::move("attribute7"s), m_attribute7, preVisit, visit, postVisit);
-            doTripletForwardVisit(8, std::move("uint32_t"s), std::move("attribute8"s), m_attribute8, preVisit, visit, postVisit);
-            doTripletForwardVisit(9, std::move("int64_t"s), std::move("attribute9"s), m_attribute9, preVisit, visit, postVisit);
-            doTripletForwardVisit(10, std::move("uint64_t"s), std::move("attribute10"s), m_attribute10, preVisit, visit, postVisit);
-            doTripletForwardVisit(11, std::move("float"s), std::move("attribute11"s), m_attribute11, preVisit, visit, postVisit);
-            doTripletForwardVisit(12, std::move("double"s), std::move("attribute12"s), m_attribute12, preVisit, visit, postVisit);
-            doTripletForwardVisit(13, std::move("std::string"s), std::move("attribute13"s), m_attribute13, preVisit, visit, postVisit);
-            doTripletForwardVisit(14, std::move("std::string"s), std::move("attribute14"s), m_attribute14, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "bool", "attribute1", m_attribute1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "char", "attribute2", m_attribute2, preVisit, visit, postVisit);
+            doTripletForwardVisit(3, "int8_t", "attribute3", m_attribute3, preVisit, visit, postVisit);
+            doTripletForwardVisit(4, "uint8_t", "attribute4", m_attribute4, preVisit, visit, postVisit);
+            doTripletForwardVisit(5, "int16_t", "attribute5", m_attribute5, preVisit, visit, postVisit);
+            doTripletForwardVisit(6, "uint16_t", "attribute6", m_attribute6, preVisit, visit, postVisit);
+            doTripletForwardVisit(7, "int32_t", "attribute7", m_attribute7, preVisit, visit, postVisit);
+            doTripletForwardVisit(8, "uint32_t", "attribute8", m_attribute8, preVisit, visit, postVisit);
+            doTripletForwardVisit(9, "int64_t", "attribute9", m_attribute9, preVisit, visit, postVisit);
+            doTripletForwardVisit(10, "uint64_t", "attribute10", m_attribute10, preVisit, visit, postVisit);
+            doTripletForwardVisit(11, "float", "attribute11", m_attribute11, preVisit, visit, postVisit);
+            doTripletForwardVisit(12, "double", "attribute12", m_attribute12, preVisit, visit, postVisit);
+            doTripletForwardVisit(13, "std::string", "attribute13", m_attribute13, preVisit, visit, postVisit);
+            doTripletForwardVisit(14, "std::string", "attribute14", m_attribute14, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -3288,16 +3498,16 @@ message MyMessage2 [id = 2] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -3306,9 +3516,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -3321,17 +3537,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -3345,9 +3561,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -3385,11 +3607,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -3416,7 +3640,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -3425,7 +3649,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+            doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
             visitor.postVisit();
         }
 
@@ -3433,7 +3657,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "attribute1", m_attribute1, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -3467,16 +3691,16 @@ struct isTripletForwardVisitable<MyMessage1> {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -3485,9 +3709,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -3500,17 +3730,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -3524,9 +3754,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -3564,11 +3800,13 @@ class LIB_API MyMessage2 {
         inline static int32_t ID() {
             return 2;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -3602,11 +3840,11 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
+                doVisit(1, "uint8_t", "field1", m_field1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("MyMessage1"s), std::move("field2"s), m_field2, visitor);
+                doVisit(2, "MyMessage1", "field2", m_field2, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -3615,8 +3853,8 @@ class LIB_API MyMessage2 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
-            doVisit(2, std::move("MyMessage1"s), std::move("field2"s), m_field2, visitor);
+            doVisit(1, "uint8_t", "field1", m_field1, visitor);
+            doVisit(2, "MyMessage1", "field2", m_field2, visitor);
             visitor.postVisit();
         }
 
@@ -3624,8 +3862,8 @@ class LIB_API MyMessage2 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("MyMessage1"s), std::move("field2"s), m_field2, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "uint8_t", "field1", m_field1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "MyMessage1", "field2", m_field2, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -3691,16 +3929,16 @@ message DEF.MyMessage2 [id = 2] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -3709,9 +3947,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -3724,17 +3968,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -3748,9 +3992,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -3788,11 +4038,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -3819,7 +4071,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -3828,7 +4080,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+            doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
             visitor.postVisit();
         }
 
@@ -3836,7 +4088,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "attribute1", m_attribute1, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -3870,16 +4122,16 @@ struct isTripletForwardVisitable<DEF::MyMessage1> {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -3888,9 +4140,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -3903,17 +4161,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -3927,9 +4185,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -3967,11 +4231,13 @@ class LIB_API MyMessage2 {
         inline static int32_t ID() {
             return 2;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -4005,11 +4271,11 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
+                doVisit(1, "uint8_t", "field1", m_field1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+                doVisit(2, "DEF::MyMessage1", "field2", m_field2, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -4018,8 +4284,8 @@ class LIB_API MyMessage2 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
-            doVisit(2, std::move("DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+            doVisit(1, "uint8_t", "field1", m_field1, visitor);
+            doVisit(2, "DEF::MyMessage1", "field2", m_field2, visitor);
             visitor.postVisit();
         }
 
@@ -4027,8 +4293,8 @@ class LIB_API MyMessage2 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("DEF::MyMessage1"s), std::move("field2"s), m_field2, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "uint8_t", "field1", m_field1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "DEF::MyMessage1", "field2", m_field2, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -4095,16 +4361,16 @@ message MyMessage2 [id = 2] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -4113,9 +4379,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -4128,17 +4400,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -4152,9 +4424,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -4192,11 +4470,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -4223,7 +4503,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -4232,7 +4512,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+            doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
             visitor.postVisit();
         }
 
@@ -4240,7 +4520,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "attribute1", m_attribute1, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -4274,16 +4554,16 @@ struct isTripletForwardVisitable<DEF::MyMessage1> {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -4292,9 +4572,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -4307,17 +4593,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -4331,9 +4617,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -4371,11 +4663,13 @@ class LIB_API MyMessage2 {
         inline static int32_t ID() {
             return 2;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -4409,11 +4703,11 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
+                doVisit(1, "uint8_t", "field1", m_field1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+                doVisit(2, "DEF::MyMessage1", "field2", m_field2, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -4422,8 +4716,8 @@ class LIB_API MyMessage2 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
-            doVisit(2, std::move("DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+            doVisit(1, "uint8_t", "field1", m_field1, visitor);
+            doVisit(2, "DEF::MyMessage1", "field2", m_field2, visitor);
             visitor.postVisit();
         }
 
@@ -4431,8 +4725,8 @@ class LIB_API MyMessage2 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("DEF::MyMessage1"s), std::move("field2"s), m_field2, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "uint8_t", "field1", m_field1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "DEF::MyMessage1", "field2", m_field2, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -4500,16 +4794,16 @@ message DEF.MyMessage2 [id = 2] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -4518,9 +4812,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -4533,17 +4833,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -4557,9 +4857,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -4597,11 +4903,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -4628,7 +4936,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -4637,7 +4945,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+            doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
             visitor.postVisit();
         }
 
@@ -4645,7 +4953,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "attribute1", m_attribute1, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -4679,16 +4987,16 @@ struct isTripletForwardVisitable<ABC::DEF::MyMessage1> {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -4697,9 +5005,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -4712,17 +5026,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -4736,9 +5050,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -4776,11 +5096,13 @@ class LIB_API MyMessage2 {
         inline static int32_t ID() {
             return 2;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -4814,11 +5136,11 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
+                doVisit(1, "uint8_t", "field1", m_field1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("ABC::DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+                doVisit(2, "ABC::DEF::MyMessage1", "field2", m_field2, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -4827,8 +5149,8 @@ class LIB_API MyMessage2 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
-            doVisit(2, std::move("ABC::DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+            doVisit(1, "uint8_t", "field1", m_field1, visitor);
+            doVisit(2, "ABC::DEF::MyMessage1", "field2", m_field2, visitor);
             visitor.postVisit();
         }
 
@@ -4836,8 +5158,8 @@ class LIB_API MyMessage2 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("ABC::DEF::MyMessage1"s), std::move("field2"s), m_field2, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "uint8_t", "field1", m_field1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "ABC::DEF::MyMessage1", "field2", m_field2, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -4905,16 +5227,16 @@ message DEF.MyMessage2 [id = 2] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -4923,9 +5245,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -4938,17 +5266,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -4962,9 +5290,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -5002,11 +5336,13 @@ class LIB_API MyMessage1 {
         inline static int32_t ID() {
             return 1;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -5033,7 +5369,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -5042,7 +5378,7 @@ class LIB_API MyMessage1 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+            doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
             visitor.postVisit();
         }
 
@@ -5050,7 +5386,7 @@ class LIB_API MyMessage1 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "std::string", "attribute1", m_attribute1, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -5084,16 +5420,16 @@ struct isTripletForwardVisitable<ABC::GHI::DEF::MyMessage1> {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -5102,9 +5438,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -5117,17 +5459,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -5141,9 +5483,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -5181,11 +5529,13 @@ class LIB_API MyMessage2 {
         inline static int32_t ID() {
             return 2;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -5219,11 +5569,11 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
+                doVisit(1, "uint8_t", "field1", m_field1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("ABC::GHI::DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+                doVisit(2, "ABC::GHI::DEF::MyMessage1", "field2", m_field2, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -5232,8 +5582,8 @@ class LIB_API MyMessage2 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
-            doVisit(2, std::move("ABC::GHI::DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+            doVisit(1, "uint8_t", "field1", m_field1, visitor);
+            doVisit(2, "ABC::GHI::DEF::MyMessage1", "field2", m_field2, visitor);
             visitor.postVisit();
         }
 
@@ -5241,8 +5591,8 @@ class LIB_API MyMessage2 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("ABC::GHI::DEF::MyMessage1"s), std::move("field2"s), m_field2, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "uint8_t", "field1", m_field1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "ABC::GHI::DEF::MyMessage1", "field2", m_field2, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -5281,3 +5631,36 @@ struct isTripletForwardVisitable<ABC::GHI::DEF::MyMessage2> {
 //    std::cout << t.content() << std::endl;
     REQUIRE(t.content() == std::string(EXPECTED_HEADER2));
 }
+
+TEST_CASE("Transforming one message with and without Proto codec.") {
+    const char *input = R"(
+message MyMessage1 [id = 1] {
+    uint32 v [id = 1];
+    float f [id = 2];
+    double d [id = 3];
+    string s [id = 20];
+}
+)";
+
+    cluon::MessageParser mp;
+    auto retVal = mp.parse(std::string(input));
+    REQUIRE(cluon::MessageParser::MessageParserErrorCodes::NO_MESSAGEPARSER_ERROR == retVal.second);
+    REQUIRE(1 == retVal.first.size());
+
+    cluon::MetaMessageToCPPTransformator withoutProtoCodec;
+    retVal.first[0].accept([&trans = withoutProtoCodec](const cluon::MetaMessage &_mm) { trans.visit(_mm); });
+    REQUIRE(std::string::npos == withoutProtoCodec.content().find("PROTO_CODEC"));
+    REQUIRE(std::string::npos == withoutProtoCodec.content().find("decodeProto"));
+
+    cluon::MetaMessageToCPPTransformator withProtoCodec{true};
+    retVal.first[0].accept([&trans = withProtoCodec](const cluon::MetaMessage &_mm) { trans.visit(_mm); });
+    const std::string CONTENT{withProtoCodec.content()};
+    REQUIRE(std::string::npos != CONTENT.find("#ifndef PROTO_CODEC"));
+    REQUIRE(std::string::npos != CONTENT.find("std::size_t protoSize() const noexcept {"));
+    REQUIRE(std::string::npos != CONTENT.find("bool decodeProto(const char *data, std::size_t size) noexcept {"));
+    // Keys are (field identifier << 3) | wire type.
+    REQUIRE(std::string::npos != CONTENT.find("case 8:"));
+    REQUIRE(std::string::npos != CONTENT.find("case 21:"));
+    REQUIRE(std::string::npos != CONTENT.find("case 25:"));
+    REQUIRE(std::string::npos != CONTENT.find("case 162:"));
+}
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon/FromProtoVisitor.hpp"
+#include "cluon/ToProtoVisitor.hpp"
+#include "cluon/cluon.hpp"
+#include "cluon/cluonTestDataStructures.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+template <typename T>
+static std::string encodeWithVisitor(T &msg) {
+    cluon::ToProtoVisitor protoEncoder;
+    msg.accept(protoEncoder);
+    return protoEncoder.encodedData();
+}
+
+TEST_CASE("Testing generated Proto codec for MyTestMessage1 with all data types.") {
+    testdata::MyTestMessage1 tmp;
+    tmp.attribute1(false)
+        .attribute2('d')
+        .attribute3(std::numeric_limits<int8_t>::min())
+        .attribute4(std::numeric_limits<uint8_t>::max())
+        .attribute5(std::numeric_limits<int16_t>::min())
+        .attribute6(std::numeric_limits<uint16_t>::max())
+        .attribute7(std::numeric_limits<int32_t>::min())
+        .attribute8(std::numeric_limits<uint32_t>::max())
+        .attribute9(std::numeric_limits<int64_t>::min())
+        .attribute10(std::numeric_limits<uint64_t>::max())
+        .attribute11(-1.25f)
+        .attribute12(-10.5)
+        .attribute13("Hello cluon World!")
+        .attribute14(std::string("\0\1\2", 3));
+
+    const std::string EXPECTED{encodeWithVisitor(tmp)};
+    REQUIRE(EXPECTED.size() == tmp.protoSize());
+
+    std::string s;
+    tmp.encodeProto(s);
+    REQUIRE(EXPECTED == s);
+
+    testdata::MyTestMessage1 tmp2;
+    REQUIRE(tmp2.decodeProto(s.data(), s.size()));
+    REQUIRE(!tmp2.attribute1());
+    REQUIRE('d' == tmp2.attribute2());
+    REQUIRE(std::numeric_limits<int8_t>::min() == tmp2.attribute3());
+    REQUIRE(std::numeric_limits<uint8_t>::max() == tmp2.attribute4());
+    REQUIRE(std::numeric_limits<int16_t>::min() == tmp2.attribute5());
+    REQUIRE(std::numeric_limits<uint16_t>::max() == tmp2.attribute6());
+    REQUIRE(std::numeric_limits<int32_t>::min() == tmp2.attribute7());
+    REQUIRE(std::numeric_limits<uint32_t>::max() == tmp2.attribute8());
+    REQUIRE(std::numeric_limits<int64_t>::min() == tmp2.attribute9());
+    REQUIRE(std::numeric_limits<uint64_t>::max() == tmp2.attribute10());
+    REQUIRE(-1.25f == Approx(tmp2.attribute11()));
+    REQUIRE(-10.5 == Approx(tmp2.attribute12()));
+    REQUIRE("Hello cluon World!" == tmp2.attribute13());
+    REQUIRE(std::string("\0\1\2", 3) == tmp2.attribute14());
+}
+
+TEST_CASE("Testing generated Proto codec for MyTestMessage5 against the visitors.") {
+    testdata::MyTestMessage5 tmp;
+    tmp.attribute1(3)
+        .attribute2(-3)
+        .attribute3(103)
+        .attribute4(-103)
+        .attribute5(10003)
+        .attribute6(-10003)
+        .attribute7(54321)
+        .attribute8(-54321)
+        .attribute9(-5.4321f)
+        .attribute10(-50.4321)
+        .attribute11("Hello cluon World!");
+
+    // The visitor decodes the output of the generated encoder.
+    std::string s;
+    tmp.encodeProto(s);
+    REQUIRE(58 == s.size());
+    REQUIRE(encodeWithVisitor(tmp) == s);
+
+    testdata::MyTestMessage5 tmp2;
+    cluon::FromProtoVisitor protoDecoder;
+    protoDecoder.decodeFrom(s.data(), s.size(), tmp2);
+    REQUIRE(3 == tmp2.attribute1());
+    REQUIRE(-3 == tmp2.attribute2());
+    REQUIRE(103 == tmp2.attribute3());
+    REQUIRE(-103 == tmp2.attribute4());
+    REQUIRE(10003 == tmp2.attribute5());
+    REQUIRE(-10003 == tmp2.attribute6());
+    REQUIRE(54321 == tmp2.attribute7());
+    REQUIRE(-54321 == tmp2.attribute8());
+    REQUIRE(-5.4321f == Approx(tmp2.attribute9()));
+    REQUIRE(-50.4321 == Approx(tmp2.attribute10()));
+    REQUIRE("Hello cluon World!" == tmp2.attribute11());
+
+    // The generated decoder decodes the output of the visitor.
+    testdata::MyTestMessage5 tmp3;
+    const std::string DATA{encodeWithVisitor(tmp)};
+    REQUIRE(tmp3.decodeProto(DATA.data(), DATA.size()));
+    REQUIRE(encodeWithVisitor(tmp3) == DATA);
+}
+
+TEST_CASE("Testing generated Proto codec for nested messages, non-consecutive field identifiers, and empty messages.") {
+    testdata::MyTestMessage7 tmp7;
+    testdata::MyTestMessage2 tmp2;
+    tmp7.attribute1(tmp2.attribute1(9)).attribute2(54321).attribute3(tmp2.attribute1(200));
+
+    std::string s;
+    tmp7.encodeProto(s);
+    REQUIRE(encodeWithVisitor(tmp7) == s);
+    REQUIRE(s.size() == tmp7.protoSize());
+
+    testdata::MyTestMessage7 tmp7_2;
+    REQUIRE(tmp7_2.decodeProto(s.data(), s.size()));
+    REQUIRE(9 == tmp7_2.attribute1().attribute1());
+    REQUIRE(54321 == tmp7_2.attribute2());
+    REQUIRE(200 == tmp7_2.attribute3().attribute1());
+
+    testdata::MyTestMessage12 tmp12;
+    tmp12.attribute9(-1234567).attribute8(7654321);
+    const std::string DATA12{encodeWithVisitor(tmp12)};
+    std::string s12;
+    tmp12.encodeProto(s12);
+    REQUIRE(DATA12 == s12);
+    testdata::MyTestMessage12 tmp12_2;
+    REQUIRE(tmp12_2.decodeProto(s12.data(), s12.size()));
+    REQUIRE(-1234567 == tmp12_2.attribute9());
+    REQUIRE(7654321 == tmp12_2.attribute8());
+
+    testdata::MyTestMessage11 tmp11;
+    REQUIRE(0 == tmp11.protoSize());
+    std::string s11{"abc"};
+    tmp11.encodeProto(s11);
+    REQUIRE("abc" == s11);
+    // Fields of other messages are skipped.
+    REQUIRE(tmp11.decodeProto(s12.data(), s12.size()));
+}
+
+TEST_CASE("Testing generated Proto codec appending to a buffer and decoding unknown, mismatching, and truncated fields.") {
+    testdata::MyTestMessage3 tmp;
+    tmp.attribute1(5).attribute2(-6);
+
+    std::string s{"prefix"};
+    tmp.encodeProto(s);
+    REQUIRE("prefix" == s.substr(0, 6));
+    REQUIRE(encodeWithVisitor(tmp) == s.substr(6));
+
+    // Unknown fields of all wire types before the known fields.
+    std::string data;
+    data.push_back(static_cast<char>((12 << 3) | 0)); // VarInt.
+    data.push_back(static_cast<char>(0x96));
+    data.push_back(static_cast<char>(0x01));
+    data.push_back(static_cast<char>((13 << 3) | 1)); // Eight bytes.
+    data.append(8, '\x11');
+    data.push_back(static_cast<char>((14 << 3) | 2)); // Length delimited.
+    data.push_back(static_cast<char>(3));
+    data.append("xyz");
+    data.push_back(static_cast<char>((15 << 3) | 5)); // Four bytes.
+    data.append(4, '\x22');
+    // Known field with mismatching wire type.
+    data.push_back(static_cast<char>((1 << 3) | 5));
+    data.append(4, '\x33');
+    data.append(s.substr(6));
+
+    testdata::MyTestMessage3 tmp2;
+    tmp2.attribute1(1).attribute2(1);
+    REQUIRE(tmp2.decodeProto(data.data(), data.size()));
+    REQUIRE(5 == tmp2.attribute1());
+    REQUIRE(-6 == tmp2.attribute2());
+
+    // Decoding stops at truncated data; previous fields keep their values.
+    testdata::MyTestMessage5 tmp5;
+    tmp5.attribute1(42).attribute11("Hello cluon World!");
+    std::string s5;
+    tmp5.encodeProto(s5);
+    testdata::MyTestMessage5 tmp5_2;
+    tmp5_2.attribute11("unchanged");
+    REQUIRE(!tmp5_2.decodeProto(s5.data(), s5.size() - 1));
+    REQUIRE(42 == tmp5_2.attribute1());
+    REQUIRE("unchanged" == tmp5_2.attribute11());
+
+    // Unsupported wire types.
+    const std::string GROUP{static_cast<char>((1 << 3) | 3)};
+    REQUIRE(!tmp5_2.decodeProto(GROUP.data(), GROUP.size()));
+}
@@ -372,3 +372,266 @@ TEST_CASE("Testing MyTestMessage7 with visitor to visit nested messages for seri
                   []() {});
     std::cout << buffer.str() << std::endl;
 }
+
+TEST_CASE("Testing ToProtoVisitor with reserved capacity, reset, and a caller-supplied buffer.") {
+    testdata::MyTestMessage2 tmp;
+    tmp.attribute1(150);
+
+    cluon::ToProtoVisitor protoEncoder;
+    protoEncoder.reserve(1024);
+    tmp.accept(protoEncoder);
+    REQUIRE(3 == protoEncoder.size());
+    REQUIRE(std::string("\x08\x96\x01", 3) == std::string(protoEncoder.data(), protoEncoder.size()));
+
+    const char *DATA{protoEncoder.data()};
+    protoEncoder.reset();
+    REQUIRE(0 == protoEncoder.size());
+    REQUIRE(protoEncoder.encodedData().empty());
+
+    // Reencoding reuses the memory.
+    tmp.accept(protoEncoder);
+    REQUIRE(DATA == protoEncoder.data());
+    REQUIRE(std::string("\x08\x96\x01", 3) == protoEncoder.encodedData());
+
+    std::string buffer{"Prefix"};
+    {
+        cluon::ToProtoVisitor protoEncoder2{buffer};
+        REQUIRE(0 == protoEncoder2.size());
+        tmp.accept(protoEncoder2);
+        REQUIRE(3 == protoEncoder2.size());
+        REQUIRE(std::string("\x08\x96\x01", 3) == protoEncoder2.encodedData());
+        REQUIRE(std::string("Prefix\x08\x96\x01", 9) == buffer);
+
+        // Resetting keeps the existing content of the buffer.
+        protoEncoder2.reset();
+        REQUIRE(0 == protoEncoder2.size());
+        REQUIRE("Prefix" == buffer);
+    }
+}
+
+TEST_CASE("Testing FromProtoVisitor decoding MyTestMessage5 and MyTestMessage7 directly from memory.") {
+    testdata::MyTestMessage5 tmp;
+    tmp.attribute1(3).attribute2(-3).attribute3(103).attribute4(-103).attribute5(10003).attribute6(-10003);
+    tmp.attribute7(54321).attribute8(-74321).attribute9(-5.4321f).attribute10(-5.4321).attribute11("Hello cluon World!");
+
+    cluon::ToProtoVisitor protoEncoder;
+    tmp.accept(protoEncoder);
+    const std::string DATA{protoEncoder.encodedData()};
+
+    // Direct visit.
+    {
+        testdata::MyTestMessage5 tmp2;
+        cluon::FromProtoVisitor protoDecoder;
+        protoDecoder.decodeFrom(DATA.data(), DATA.size(), tmp2);
+        REQUIRE(tmp2.attribute1() == tmp.attribute1());
+        REQUIRE(tmp2.attribute2() == tmp.attribute2());
+        REQUIRE(tmp2.attribute3() == tmp.attribute3());
+        REQUIRE(tmp2.attribute4() == tmp.attribute4());
+        REQUIRE(tmp2.attribute5() == tmp.attribute5());
+        REQUIRE(tmp2.attribute6() == tmp.attribute6());
+        REQUIRE(tmp2.attribute7() == tmp.attribute7());
+        REQUIRE(tmp2.attribute8() == tmp.attribute8());
+        REQUIRE(tmp2.attribute9() == Approx(tmp.attribute9()));
+        REQUIRE(tmp2.attribute10() == Approx(tmp.attribute10()));
+        REQUIRE(tmp2.attribute11() == tmp.attribute11());
+    }
+
+    // Decoding into the map; the decoded values must not depend on the source data.
+    {
+        cluon::FromProtoVisitor protoDecoder;
+        {
+            const std::string COPY{DATA};
+            protoDecoder.decodeFrom(COPY.data(), COPY.size());
+        }
+        testdata::MyTestMessage5 tmp2;
+        tmp2.accept(protoDecoder);
+        REQUIRE(tmp2.attribute8() == tmp.attribute8());
+        REQUIRE(tmp2.attribute10() == Approx(tmp.attribute10()));
+        REQUIRE(tmp2.attribute11() == tmp.attribute11());
+    }
+
+    testdata::MyTestMessage7 tmp7;
+    testdata::MyTestMessage2 tmp2_1;
+    tmp7.attribute1(tmp2_1.attribute1(9)).attribute2(12);
+    testdata::MyTestMessage2 tmp2_3;
+    tmp7.attribute3(tmp2_3.attribute1(13));
+
+    cluon::ToProtoVisitor protoEncoder7;
+    tmp7.accept(protoEncoder7);
+    const std::string DATA7{protoEncoder7.encodedData()};
+    {
+        testdata::MyTestMessage7 tmp7_2;
+        cluon::FromProtoVisitor protoDecoder;
+        protoDecoder.decodeFrom(DATA7.data(), DATA7.size(), tmp7_2);
+        REQUIRE(9 == tmp7_2.attribute1().attribute1());
+        REQUIRE(12 == tmp7_2.attribute2());
+        REQUIRE(13 == tmp7_2.attribute3().attribute1());
+    }
+    {
+        testdata::MyTestMessage7 tmp7_2;
+        cluon::FromProtoVisitor protoDecoder;
+        protoDecoder.decodeFrom(DATA7.data(), DATA7.size());
+        tmp7_2.accept(protoDecoder);
+        REQUIRE(9 == tmp7_2.attribute1().attribute1());
+        REQUIRE(12 == tmp7_2.attribute2());
+        REQUIRE(13 == tmp7_2.attribute3().attribute1());
+    }
+}
+
+TEST_CASE("Testing FromProtoVisitor decoding truncated data from memory.") {
+    testdata::MyTestMessage5 tmp;
+    tmp.attribute1(3).attribute11("Hello cluon World!");
+
+    cluon::ToProtoVisitor protoEncoder;
+    tmp.accept(protoEncoder);
+    const std::string DATA{protoEncoder.encodedData()};
+
+    // The string is the last field; cut it off.
+    testdata::MyTestMessage5 tmp2;
+    tmp2.attribute11("Unchanged");
+    cluon::FromProtoVisitor protoDecoder;
+    protoDecoder.decodeFrom(DATA.data(), DATA.size() - 1, tmp2);
+    REQUIRE(3 == tmp2.attribute1());
+    REQUIRE("Unchanged" == tmp2.attribute11());
+
+    // Incomplete VarInt.
+    const std::string INCOMPLETE{"\x08\x96", 2};
+    testdata::MyTestMessage2 tmp3;
+    protoDecoder.decodeFrom(INCOMPLETE.data(), INCOMPLETE.size(), tmp3);
+    REQUIRE(123 == tmp3.attribute1());
+
+    // Nothing to decode.
+    protoDecoder.decodeFrom(nullptr, 0, tmp3);
+    REQUIRE(123 == tmp3.attribute1());
+}
+
+TEST_CASE("Testing FromProtoVisitor decoding fields with mismatching Proto types directly from memory.") {
+    cluon::FromProtoVisitor protoDecoder;
+
+    // A string followed by the same field as VarInt claiming 4096 bytes.
+    const std::string STRING_AND_VARINT{"\x12\x03" "abc" "\x10\x80\x20", 8};
+    testdata::MyTestMessage4 tmp4;
+    protoDecoder.decodeFrom(STRING_AND_VARINT.data(), STRING_AND_VARINT.size(), tmp4);
+    REQUIRE("abc" == tmp4.attribute1());
+
+    // A string and a nested message encoded as VarInt without a preceding string.
+    const std::string VARINT{"\x10\x80\x20", 3};
+    testdata::MyTestMessage4 tmp4_2;
+    tmp4_2.attribute1("Unchanged");
+    protoDecoder.decodeFrom(VARINT.data(), VARINT.size(), tmp4_2);
+    REQUIRE("Unchanged" == tmp4_2.attribute1());
+
+    const std::string NESTED_AS_VARINT{"\x18\x80\x20", 3};
+    testdata::MyTestMessage6 tmp6;
+    protoDecoder.decodeFrom(NESTED_AS_VARINT.data(), NESTED_AS_VARINT.size(), tmp6);
+    REQUIRE(123 == tmp6.attribute1().attribute1());
+
+    // Numbers encoded with other Proto types.
+    const std::string INTEGER_AS_STRING{"\x0A\x03" "abc", 5};
+    testdata::MyTestMessage2 tmp2;
+    protoDecoder.decodeFrom(INTEGER_AS_STRING.data(), INTEGER_AS_STRING.size(), tmp2);
+    REQUIRE(123 == tmp2.attribute1());
+
+    const std::string FLOAT_AND_DOUBLE_AS_VARINT{"\x08\x05\x10\x06", 4};
+    testdata::MyTestMessage9 tmp9;
+    protoDecoder.decodeFrom(FLOAT_AND_DOUBLE_AS_VARINT.data(), FLOAT_AND_DOUBLE_AS_VARINT.size(), tmp9);
+    REQUIRE(-1.2345f == Approx(tmp9.attribute1()));
+    REQUIRE(-10.2345 == Approx(tmp9.attribute2()));
+}
+
+TEST_CASE("Testing FromProtoVisitor with sparse and repeated field identifiers and mismatching types.") {
+    cluon::ToProtoVisitor protoEncoder;
+    {
+        uint32_t a{42};
+        uint32_t b{43};
+        std::string c{"Hello"};
+        double d{1.5};
+        uint32_t e{44};
+        protoEncoder.visit(3, "", "", a);
+        protoEncoder.visit(3, "", "", b);
+        protoEncoder.visit(1000, "", "", c);
+        protoEncoder.visit(70000, "", "", d);
+        protoEncoder.visit(1001, "", "", e);
+    }
+    const std::string DATA{protoEncoder.encodedData()};
+
+    cluon::FromProtoVisitor protoDecoder;
+    for (uint32_t run{0}; run < 2; run++) {
+        protoDecoder.decodeFrom(DATA.data(), DATA.size());
+
+        // The first occurrence of a field is used.
+        uint32_t a{0};
+        protoDecoder.visit(3, "", "", a);
+        REQUIRE(42 == a);
+
+        std::string c;
+        protoDecoder.visit(1000, "", "", c);
+        REQUIRE("Hello" == c);
+
+        double d{0};
+        protoDecoder.visit(70000, "", "", d);
+        REQUIRE(1.5 == Approx(d));
+
+        uint32_t e{0};
+        protoDecoder.visit(1001, "", "", e);
+        REQUIRE(44 == e);
+
+        // Missing fields and fields of other types are not decoded.
+        uint32_t missing{7};
+        protoDecoder.visit(4, "", "", missing);
+        REQUIRE(7 == missing);
+        protoDecoder.visit(1000, "", "", missing);
+        REQUIRE(7 == missing);
+        float f{2.5f};
+        protoDecoder.visit(70000, "", "", f);
+        REQUIRE(2.5f == Approx(f));
+    }
+
+    // Fields of a previous decoding are not visible after decoding other data.
+    testdata::MyTestMessage2 tmp;
+    tmp.attribute1(150);
+    cluon::ToProtoVisitor protoEncoder2;
+    tmp.accept(protoEncoder2);
+    const std::string DATA2{protoEncoder2.encodedData()};
+    protoDecoder.decodeFrom(DATA2.data(), DATA2.size());
+    uint32_t a{0};
+    protoDecoder.visit(3, "", "", a);
+    REQUIRE(0 == a);
+    std::string c;
+    protoDecoder.visit(1000, "", "", c);
+    REQUIRE(c.empty());
+
+    // Copies of a decoder hold the decoded fields.
+    cluon::FromProtoVisitor protoDecoder2;
+    protoDecoder2 = protoDecoder;
+    testdata::MyTestMessage2 tmp2;
+    tmp2.accept(protoDecoder2);
+    REQUIRE(150 == tmp2.attribute1());
+}
+
+TEST_CASE("Testing ToProtoVisitor and FromProtoVisitor with type and field names passed as std::string.") {
+    testdata::MyTestMessage6 tmp6;
+    testdata::MyTestMessage2 tmp2;
+    tmp6.attribute1(tmp2.attribute1(150));
+
+    cluon::ToProtoVisitor protoEncoder;
+    tmp6.accept(protoEncoder);
+    const std::string EXPECTED{protoEncoder.encodedData()};
+
+    // Former visitor protocol as used by previously generated messages.
+    testdata::MyTestMessage2 nested{tmp6.attribute1()};
+    cluon::ToProtoVisitor protoEncoder2;
+    doVisit(3, std::string("testdata::MyTestMessage2"), std::string("attribute1"), nested, protoEncoder2);
+    REQUIRE(EXPECTED == protoEncoder2.encodedData());
+
+    uint8_t v{150};
+    cluon::ToProtoVisitor protoEncoder3;
+    protoEncoder3.visit(1, std::string("uint8_t"), std::string("attribute1"), v);
+    REQUIRE(EXPECTED.substr(2) == protoEncoder3.encodedData());
+
+    cluon::FromProtoVisitor protoDecoder;
+    protoDecoder.decodeFrom(EXPECTED.data(), EXPECTED.size());
+    testdata::MyTestMessage2 decoded;
+    protoDecoder.visit(3, std::string("testdata::MyTestMessage2"), std::string("attribute1"), decoded);
+    REQUIRE(150 == decoded.attribute1());
+}
@@ -12,8 +12,17 @@
 #include "cluon/FromProtoVisitor.hpp"
 #include "cluon/OD4Session.hpp"
 #include "cluon/Time.hpp"
+#include "cluon/UDPSender.hpp"
 #include "cluon/cluonDataStructures.hpp"
 
+// clang-format off
+#ifndef WIN32
+    #include <sys/types.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+// clang-format on
+
 #include <iostream>
 
 #include <atomic>
@@ -499,3 +508,705 @@ TEST_CASE("Create OD4 session with dataTrigger and transmission storm from 5 thr
 #endif
 #endif
 }
+
+TEST_CASE("Create two OD4 sessions in the same process exchanging Envelopes in-process exactly once.") {
+    std::mutex receivingMutex;
+    std::vector<cluon::data::Envelope> receiving;
+
+    cluon::OD4Session od4(90, [&receivingMutex, &receiving](cluon::data::Envelope &&envelope) {
+        std::lock_guard<std::mutex> lck(receivingMutex);
+        receiving.push_back(envelope);
+    });
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+    REQUIRE(od4.isRunning());
+
+    cluon::OD4Session od4ToSendFrom(90);
+    do { std::this_thread::sleep_for(1ms); } while (!od4ToSendFrom.isRunning());
+    REQUIRE(od4ToSendFrom.isRunning());
+
+    constexpr int32_t MAX_ENVELOPES{100};
+    for (int32_t i{0}; i < MAX_ENVELOPES; i++) {
+        cluon::data::TimeStamp tsRequest;
+        tsRequest.seconds(1).microseconds(i);
+        od4ToSendFrom.send(tsRequest);
+    }
+
+    int32_t maxWaitingIn10Milliseconds{500};
+    do {
+        std::this_thread::sleep_for(10ms);
+        std::lock_guard<std::mutex> lck(receivingMutex);
+        if (MAX_ENVELOPES <= static_cast<int32_t>(receiving.size())) {
+            break;
+        }
+    } while (maxWaitingIn10Milliseconds-- > 0);
+
+    // Allow for a possible, but unwanted duplicate delivery via UDP multicast.
+    std::this_thread::sleep_for(250ms);
+
+    std::lock_guard<std::mutex> lck(receivingMutex);
+    REQUIRE(MAX_ENVELOPES == static_cast<int32_t>(receiving.size()));
+    for (int32_t i{0}; i < MAX_ENVELOPES; i++) {
+        REQUIRE(cluon::data::TimeStamp::ID() == receiving[static_cast<std::size_t>(i)].dataType());
+        REQUIRE(0 < receiving[static_cast<std::size_t>(i)].received().seconds());
+        cluon::data::TimeStamp tsResponse = cluon::extractMessage<cluon::data::TimeStamp>(std::move(receiving[static_cast<std::size_t>(i)]));
+        REQUIRE(1 == tsResponse.seconds());
+        REQUIRE(i == tsResponse.microseconds());
+    }
+}
+
+TEST_CASE("Create two OD4 sessions in different processes exchanging Envelopes via shared memory exactly once.") {
+#if defined(__linux__)
+    constexpr int32_t MAX_ENVELOPES{10};
+    constexpr uint32_t LARGE_ENVELOPE{200 * 1024};
+
+    pid_t pid = fork();
+    if (0 == pid) {
+        // Child process: Wait for the parent to set up its OD4Session and send from another process.
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        {
+            cluon::OD4Session od4ToSendFrom(91);
+            if (od4ToSendFrom.enableSharedMemoryTransport()) {
+                for (int32_t i{0}; i < MAX_ENVELOPES; i++) {
+                    cluon::data::TimeStamp tsRequest;
+                    tsRequest.seconds(2).microseconds(i);
+                    od4ToSendFrom.send(tsRequest);
+                }
+                cluon::data::Envelope large;
+                large.dataType(1234).serializedData(std::string(LARGE_ENVELOPE, 'x'));
+                od4ToSendFrom.send(std::move(large));
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        }
+        _exit(0);
+    }
+    REQUIRE(0 < pid);
+
+    std::mutex receivingMutex;
+    std::vector<cluon::data::Envelope> receiving;
+
+    cluon::OD4Session od4(91, [&receivingMutex, &receiving](cluon::data::Envelope &&envelope) {
+        std::lock_guard<std::mutex> lck(receivingMutex);
+        receiving.push_back(envelope);
+    });
+    REQUIRE(od4.enableSharedMemoryTransport(16, 256 * 1024));
+    REQUIRE(od4.enableSharedMemoryTransport());
+
+    int status{0};
+    REQUIRE(pid == waitpid(pid, &status, 0));
+
+    // Allow for a possible, but unwanted duplicate delivery via UDP multicast.
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+
+    std::lock_guard<std::mutex> lck(receivingMutex);
+    REQUIRE((MAX_ENVELOPES + 1) == static_cast<int32_t>(receiving.size()));
+    for (int32_t i{0}; i < MAX_ENVELOPES; i++) {
+        REQUIRE(cluon::data::TimeStamp::ID() == receiving[static_cast<std::size_t>(i)].dataType());
+        cluon::data::TimeStamp tsResponse = cluon::extractMessage<cluon::data::TimeStamp>(std::move(receiving[static_cast<std::size_t>(i)]));
+        REQUIRE(2 == tsResponse.seconds());
+        REQUIRE(i == tsResponse.microseconds());
+    }
+    REQUIRE(1234 == receiving[MAX_ENVELOPES].dataType());
+    REQUIRE(LARGE_ENVELOPE == receiving[MAX_ENVELOPES].serializedData().size());
+#endif
+}
+
+TEST_CASE("Create two OD4 sessions in different processes exchanging large payloads via zero-copy transport.") {
+#if defined(__linux__)
+    constexpr uint32_t LARGE_PAYLOAD{1024 * 1024};
+    constexpr int32_t MAX_ENVELOPES{3};
+
+    pid_t pid = fork();
+    if (0 == pid) {
+        // Child process: Wait for the parent to set up its OD4Session and send from another process.
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        {
+            cluon::OD4Session od4ToSendFrom(93);
+            if (od4ToSendFrom.enableZeroCopyTransport(64 * 1024, 4, 2 * LARGE_PAYLOAD, cluon::OD4Session::RemoteFallback::DROP)) {
+                for (int32_t i{0}; i < MAX_ENVELOPES; i++) {
+                    cluon::data::Envelope large;
+                    large.dataType(1234).senderStamp(static_cast<uint32_t>(i)).serializedData(std::string(LARGE_PAYLOAD, static_cast<char>('a' + i)));
+                    od4ToSendFrom.send(std::move(large));
+                }
+                cluon::data::Envelope copied;
+                copied.dataType(1235).serializedData(std::string(LARGE_PAYLOAD, 'z'));
+                od4ToSendFrom.send(std::move(copied));
+
+                cluon::data::TimeStamp small;
+                small.seconds(3);
+                od4ToSendFrom.send(small);
+            }
+            // Keep the pool until the parent has received all payloads.
+            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+        }
+        _exit(0);
+    }
+    REQUIRE(0 < pid);
+
+    std::mutex receivingMutex;
+    std::vector<std::string> views;
+    std::vector<cluon::data::Envelope> copies;
+
+    cluon::OD4Session od4(93);
+    REQUIRE(od4.enableSharedMemoryTransport());
+    REQUIRE(od4.dataTriggerZeroCopy(1234, [&receivingMutex, &views](const cluon::data::Envelope &envelope, const char *data, uint32_t size) {
+        std::lock_guard<std::mutex> lck(receivingMutex);
+        REQUIRE(envelope.serializedData().empty());
+        REQUIRE(static_cast<char>('a' + envelope.senderStamp()) == data[0]);
+        views.push_back(std::string(data, size));
+    }));
+    REQUIRE(od4.dataTrigger(1235, [&receivingMutex, &copies](cluon::data::Envelope &&envelope) {
+        std::lock_guard<std::mutex> lck(receivingMutex);
+        copies.push_back(envelope);
+    }));
+    REQUIRE(od4.dataTrigger(cluon::data::TimeStamp::ID(), [&receivingMutex, &copies](cluon::data::Envelope &&envelope) {
+        std::lock_guard<std::mutex> lck(receivingMutex);
+        copies.push_back(envelope);
+    }));
+
+    int status{0};
+    REQUIRE(pid == waitpid(pid, &status, 0));
+
+    std::lock_guard<std::mutex> lck(receivingMutex);
+    REQUIRE(MAX_ENVELOPES == static_cast<int32_t>(views.size()));
+    for (int32_t i{0}; i < MAX_ENVELOPES; i++) {
+        REQUIRE(std::string(LARGE_PAYLOAD, static_cast<char>('a' + i)) == views[static_cast<std::size_t>(i)]);
+    }
+    REQUIRE(2 == copies.size());
+    REQUIRE(1235 == copies[0].dataType());
+    REQUIRE(std::string(LARGE_PAYLOAD, 'z') == copies[0].serializedData());
+    REQUIRE(cluon::data::TimeStamp::ID() == copies[1].dataType());
+    REQUIRE(3 == cluon::extractMessage<cluon::data::TimeStamp>(std::move(copies[1])).seconds());
+#endif
+}
+
+TEST_CASE("Create OD4 session counting zero-copy payloads as lost that were reused before they were accessed.") {
+#if defined(__linux__)
+    constexpr uint32_t LARGE_PAYLOAD{128 * 1024};
+    constexpr int32_t MAX_ENVELOPES{30};
+
+    pid_t pid = fork();
+    if (0 == pid) {
+        // Child process: Wait for the parent to set up its OD4Session and send from another process.
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        {
+            cluon::OD4Session od4ToSendFrom(100);
+            if (od4ToSendFrom.enableZeroCopyTransport(64 * 1024, 1, LARGE_PAYLOAD, cluon::OD4Session::RemoteFallback::DROP)) {
+                for (int32_t i{0}; i < MAX_ENVELOPES; i++) {
+                    cluon::data::Envelope large;
+                    large.dataType(1234).senderStamp(static_cast<uint32_t>(i)).serializedData(std::string(LARGE_PAYLOAD, 'x'));
+                    od4ToSendFrom.send(std::move(large));
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                }
+            }
+            // Keep the pool until the parent has received all references.
+            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+        }
+        _exit(0);
+    }
+    REQUIRE(0 < pid);
+
+    std::atomic<int32_t> received{0};
+    cluon::OD4Session od4(100);
+    od4.enableMonitor();
+    REQUIRE(od4.enableSharedMemoryTransport());
+    REQUIRE(od4.dataTriggerZeroCopy(1234, [&received](const cluon::data::Envelope &, const char *, uint32_t) {
+        // Block the first delivery for longer than the heartbeat timeout so that the sender
+        // drops this reader and reuses slots of payloads that were not accessed yet.
+        if (0 == received++) {
+            std::this_thread::sleep_for(std::chrono::microseconds(cluon::SharedMemoryPool::HEARTBEAT_TIMEOUT) + std::chrono::milliseconds(500));
+        }
+    }));
+
+    int status{0};
+    REQUIRE(pid == waitpid(pid, &status, 0));
+
+    uint64_t lost{0};
+    for (const auto &s : od4.statistics()) {
+        if (1234 == s.dataType()) {
+            lost += s.numberOfLostEnvelopes();
+        }
+    }
+    REQUIRE(0 < lost);
+    REQUIRE(1 < received.load());
+    REQUIRE(MAX_ENVELOPES >= received.load() + static_cast<int32_t>(lost));
+#endif
+}
+
+TEST_CASE("Create OD4 session with monitor to record and send statistics.") {
+    std::mutex receivingMutex;
+    std::vector<cluon::data::EnvelopeStatistics> receiving;
+
+    cluon::OD4Session od4(92);
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+    REQUIRE(od4.statistics().empty());
+    od4.enableMonitor(20.0f);
+
+    cluon::OD4Session od4ToSendFrom(92);
+    do { std::this_thread::sleep_for(1ms); } while (!od4ToSendFrom.isRunning());
+    REQUIRE(od4ToSendFrom.dataTrigger(cluon::data::EnvelopeStatistics::ID(), [&receivingMutex, &receiving](cluon::data::Envelope &&envelope) {
+        std::lock_guard<std::mutex> lck(receivingMutex);
+        receiving.push_back(cluon::extractMessage<cluon::data::EnvelopeStatistics>(std::move(envelope)));
+    }));
+
+    constexpr int32_t MAX_ENVELOPES{20};
+    for (int32_t i{0}; i < MAX_ENVELOPES; i++) {
+        cluon::data::TimeStamp tsRequest;
+        tsRequest.seconds(1).microseconds(i);
+        cluon::data::TimeStamp sampleTimeStamp{cluon::time::fromMicroseconds(cluon::time::toMicroseconds(cluon::time::now()) - 1000 * 1000)};
+        od4ToSendFrom.send(tsRequest, sampleTimeStamp, 7);
+        std::this_thread::sleep_for(5ms);
+    }
+
+    int32_t maxWaitingIn10Milliseconds{500};
+    bool receivedAll{false};
+    do {
+        std::this_thread::sleep_for(10ms);
+        std::lock_guard<std::mutex> lck(receivingMutex);
+        for (const auto &s : receiving) { receivedAll |= (MAX_ENVELOPES == static_cast<int32_t>(s.numberOfEnvelopes())); }
+    } while (!receivedAll && maxWaitingIn10Milliseconds-- > 0);
+    REQUIRE(receivedAll);
+
+    auto listOfStatistics = od4.statistics();
+    REQUIRE(1 == listOfStatistics.size());
+    auto s = listOfStatistics.front();
+    REQUIRE(cluon::data::TimeStamp::ID() == s.dataType());
+    REQUIRE(7 == s.senderStamp());
+    REQUIRE(MAX_ENVELOPES == static_cast<int32_t>(s.numberOfEnvelopes()));
+    REQUIRE(0.0f < s.rate());
+    REQUIRE(0 <= s.transportLatencyP50());
+    REQUIRE(s.transportLatencyP50() <= s.transportLatencyP99());
+    REQUIRE(s.transportLatencyP99() <= s.transportLatencyMax());
+    REQUIRE(1000 * 1000 <= s.sampleAgeP50());
+    REQUIRE(s.sampleAgeP99() <= s.sampleAgeMax());
+    REQUIRE(s.jitterP50() <= s.jitterMax());
+}
+
+TEST_CASE("Create OD4 session with monitor to track lost, duplicated, and reordered Envelopes.") {
+    cluon::OD4Session od4(93);
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+    od4.enableMonitor();
+
+    // Send Envelopes with sequence numbers via plain UDP multicast.
+    cluon::UDPSender sender{"225.0.0.93", 12175};
+    const std::vector<uint32_t> SEQUENCE_NUMBERS{1, 2, 4, 4, 3, 6, 7, 10};
+    for (auto sequenceNumber : SEQUENCE_NUMBERS) {
+        cluon::data::Envelope env;
+        env.dataType(cluon::data::TimeStamp::ID()).senderStamp(5).sent(cluon::time::now()).sampleTimeStamp(cluon::time::now());
+        sender.send(cluon::serializeEnvelope(std::move(env), sequenceNumber, 4711));
+        std::this_thread::sleep_for(5ms);
+    }
+
+    int32_t maxWaitingIn10Milliseconds{500};
+    do {
+        std::this_thread::sleep_for(10ms);
+        auto listOfStatistics = od4.statistics();
+        if (!listOfStatistics.empty() && (SEQUENCE_NUMBERS.size() == listOfStatistics.front().numberOfEnvelopes())) {
+            break;
+        }
+    } while (maxWaitingIn10Milliseconds-- > 0);
+
+    auto listOfStatistics = od4.statistics();
+    REQUIRE(1 == listOfStatistics.size());
+    auto s = listOfStatistics.front();
+    REQUIRE(5 == s.senderStamp());
+    REQUIRE(SEQUENCE_NUMBERS.size() == s.numberOfEnvelopes());
+    // 5, 8, and 9 are missing; 4 is duplicated; 3 arrived late.
+    REQUIRE(3 == s.numberOfLostEnvelopes());
+    REQUIRE(1 == s.numberOfDuplicatedEnvelopes());
+    REQUIRE(1 == s.numberOfReorderedEnvelopes());
+    REQUIRE(0.3f == Approx(s.lossRate()));
+}
+
+TEST_CASE("Create OD4 session and enable sequence numbers only on request.") {
+    using namespace std::literals::chrono_literals; // NOLINT
+    std::mutex receivedMutex;
+    std::vector<std::string> received;
+    cluon::UDPReceiver receiver{"225.0.0.99", 12175, [&received, &receivedMutex](std::string &&data, std::string &&, std::chrono::system_clock::time_point &&) {
+                                    std::lock_guard<std::mutex> lck(receivedMutex);
+                                    received.push_back(data);
+                                }};
+    REQUIRE(receiver.isRunning());
+
+    cluon::OD4Session od4(99);
+    do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+
+    auto waitFor = [&received, &receivedMutex](std::size_t n) {
+        int32_t maxWaitingIn10Milliseconds{500};
+        do {
+            std::this_thread::sleep_for(10ms);
+            std::lock_guard<std::mutex> lck(receivedMutex);
+            if (n <= received.size()) {
+                break;
+            }
+        } while (maxWaitingIn10Milliseconds-- > 0);
+        std::lock_guard<std::mutex> lck(receivedMutex);
+        return n <= received.size();
+    };
+
+    cluon::data::TimeStamp ts;
+    ts.seconds(1).microseconds(2);
+    od4.send(ts, cluon::data::TimeStamp{}, 3);
+    REQUIRE(waitFor(1));
+
+    // Without sequence numbers, the Envelope is encoded as before.
+    uint32_t sequenceNumber{0};
+    uint32_t sourceIdentifier{0};
+    uint32_t numberOfPartitions{0};
+    uint64_t sharedMemoryReference{0};
+    std::string data;
+    {
+        std::lock_guard<std::mutex> lck(receivedMutex);
+        data = received[0];
+    }
+    auto retVal = cluon::extractEnvelope(data.data(), data.size(), sequenceNumber, sourceIdentifier, numberOfPartitions, sharedMemoryReference);
+    REQUIRE(retVal.first);
+    REQUIRE(0 == sequenceNumber);
+    REQUIRE(0 == sourceIdentifier);
+    REQUIRE(data == cluon::serializeEnvelope(std::move(retVal.second)));
+
+    od4.enableSequenceNumbers();
+    od4.send(ts, cluon::data::TimeStamp{}, 3);
+    od4.send(ts, cluon::data::TimeStamp{}, 3);
+    REQUIRE(waitFor(3));
+    {
+        std::lock_guard<std::mutex> lck(receivedMutex);
+        data = received[2];
+    }
+    retVal = cluon::extractEnvelope(data.data(), data.size(), sequenceNumber, sourceIdentifier, numberOfPartitions, sharedMemoryReference);
+    REQUIRE(retVal.first);
+    REQUIRE(2 == sequenceNumber);
+    REQUIRE(0 != sourceIdentifier);
+    REQUIRE(3 == retVal.second.senderStamp());
+}
+
+TEST_CASE("Create OD4 session with a delegate for only the latest Envelopes per senderStamp.") {
+    std::mutex receivingMutex;
+    std::vector<cluon::data::TimeStamp> receiving;
+
+    cluon::OD4Session od4(94);
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+    REQUIRE(od4.dataTriggerLatest(cluon::data::TimeStamp::ID(), [&receivingMutex, &receiving](cluon::data::Envelope &&envelope) {
+        {
+            std::lock_guard<std::mutex> lck(receivingMutex);
+            receiving.push_back(cluon::extractMessage<cluon::data::TimeStamp>(std::move(envelope)));
+        }
+        // Simulate a slow consumer.
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }));
+    REQUIRE(0 == od4.numberOfConflatedEnvelopes(cluon::data::TimeStamp::ID()));
+
+    cluon::OD4Session od4ToSendFrom(94);
+    do { std::this_thread::sleep_for(1ms); } while (!od4ToSendFrom.isRunning());
+
+    constexpr int32_t MAX_ENVELOPES{50};
+    for (int32_t i{0}; i < MAX_ENVELOPES; i++) {
+        cluon::data::TimeStamp tsRequest;
+        tsRequest.seconds(1).microseconds(i);
+        od4ToSendFrom.send(tsRequest, cluon::data::TimeStamp(), 0);
+        tsRequest.seconds(2);
+        od4ToSendFrom.send(tsRequest, cluon::data::TimeStamp(), 1);
+    }
+
+    int32_t maxWaitingIn10Milliseconds{500};
+    do {
+        std::this_thread::sleep_for(10ms);
+        std::lock_guard<std::mutex> lck(receivingMutex);
+        if ((2 * MAX_ENVELOPES) == static_cast<int32_t>(receiving.size() + od4.numberOfConflatedEnvelopes(cluon::data::TimeStamp::ID()))) {
+            break;
+        }
+    } while (maxWaitingIn10Milliseconds-- > 0);
+    std::this_thread::sleep_for(100ms);
+
+    std::lock_guard<std::mutex> lck(receivingMutex);
+    REQUIRE((2 * MAX_ENVELOPES) == static_cast<int32_t>(receiving.size() + od4.numberOfConflatedEnvelopes(cluon::data::TimeStamp::ID())));
+    REQUIRE(0 < od4.numberOfConflatedEnvelopes(cluon::data::TimeStamp::ID()));
+
+    // The latest Envelope for every senderStamp is always delivered.
+    int32_t lastMicrosecondsForSenderStamp0{-1};
+    int32_t lastMicrosecondsForSenderStamp1{-1};
+    for (const auto &ts : receiving) {
+        int32_t &last = (1 == ts.seconds() ? lastMicrosecondsForSenderStamp0 : lastMicrosecondsForSenderStamp1);
+        REQUIRE(last < ts.microseconds());
+        last = ts.microseconds();
+    }
+    REQUIRE((MAX_ENVELOPES - 1) == lastMicrosecondsForSenderStamp0);
+    REQUIRE((MAX_ENVELOPES - 1) == lastMicrosecondsForSenderStamp1);
+
+    // Unsetting the delegate also removes its counter.
+    REQUIRE(od4.dataTriggerLatest(cluon::data::TimeStamp::ID(), nullptr));
+    REQUIRE(0 == od4.numberOfConflatedEnvelopes(cluon::data::TimeStamp::ID()));
+}
+
+TEST_CASE("Create OD4 sessions with rate-limited delegates using different decimation policies.") {
+    using namespace std::literals::chrono_literals; // NOLINT
+    constexpr float FREQ{20.0f};
+    constexpr int64_t PERIOD{50 * 1000};
+
+    struct Receiver {
+        std::mutex mutex;
+        std::vector<cluon::data::Envelope> envelopes;
+    };
+    Receiver first, last, evenly;
+    auto receiveInto = [](Receiver &r) {
+        return [&r](cluon::data::Envelope &&envelope) {
+            std::lock_guard<std::mutex> lck(r.mutex);
+            r.envelopes.push_back(envelope);
+        };
+    };
+
+    cluon::OD4Session od4First(95);
+    cluon::OD4Session od4Last(95);
+    cluon::OD4Session od4Evenly(95);
+    REQUIRE(od4First.dataTrigger(cluon::data::TimeStamp::ID(), FREQ, cluon::OD4Session::DecimationPolicy::FIRST_IN_WINDOW, receiveInto(first)));
+    REQUIRE(od4Last.dataTrigger(cluon::data::TimeStamp::ID(), FREQ, cluon::OD4Session::DecimationPolicy::LAST_IN_WINDOW, receiveInto(last)));
+    REQUIRE(od4Evenly.dataTrigger(cluon::data::TimeStamp::ID(), FREQ, cluon::OD4Session::DecimationPolicy::EVENLY_SPACED, receiveInto(evenly)));
+
+    cluon::OD4Session od4ToSendFrom(95);
+    do { std::this_thread::sleep_for(1ms); } while (!od4ToSendFrom.isRunning());
+
+    // Send with approximately 500 Hz for 500 ms.
+    constexpr int32_t MAX_ENVELOPES{250};
+    const cluon::data::TimeStamp BEFORE{cluon::time::now()};
+    for (int32_t i{0}; i < MAX_ENVELOPES; i++) {
+        cluon::data::TimeStamp tsRequest;
+        tsRequest.seconds(1).microseconds(i);
+        od4ToSendFrom.send(tsRequest);
+        std::this_thread::sleep_for(2ms);
+    }
+    const cluon::data::TimeStamp AFTER{cluon::time::now()};
+    std::this_thread::sleep_for(2 * std::chrono::microseconds(PERIOD));
+
+    const int64_t WINDOWS{cluon::time::deltaInMicroseconds(AFTER, BEFORE) / PERIOD};
+    for (auto r : {&first, &last, &evenly}) {
+        std::lock_guard<std::mutex> lck(r->mutex);
+        // Envelopes received after sending may still be delivered at the end of their
+        // window; thus, only Envelopes received while sending are counted: Every policy
+        // delivers at most one of them per aligned window between BEFORE and AFTER.
+        int64_t receivedWhileSending{0};
+        for (const auto &e : r->envelopes) {
+            receivedWhileSending += (cluon::time::toMicroseconds(e.received()) <= cluon::time::toMicroseconds(AFTER) ? 1 : 0);
+        }
+        REQUIRE(receivedWhileSending <= WINDOWS + 2);
+        // Windows without any received Envelope due to scheduling delays are not delivered.
+        REQUIRE(WINDOWS / 2 <= static_cast<int64_t>(r->envelopes.size()));
+    }
+    {
+        std::lock_guard<std::mutex> lck(first.mutex);
+        REQUIRE(0 == cluon::extractMessage<cluon::data::TimeStamp>(cluon::data::Envelope{first.envelopes.front()}).microseconds());
+        for (std::size_t i{1}; i < first.envelopes.size(); i++) {
+            // Every delivered Envelope is from a different window.
+            REQUIRE(cluon::time::toMicroseconds(first.envelopes[i - 1].received()) / PERIOD < cluon::time::toMicroseconds(first.envelopes[i].received()) / PERIOD);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lck(last.mutex);
+        REQUIRE((MAX_ENVELOPES - 1) == cluon::extractMessage<cluon::data::TimeStamp>(cluon::data::Envelope{last.envelopes.back()}).microseconds());
+        REQUIRE(0 < od4Last.numberOfConflatedEnvelopes(cluon::data::TimeStamp::ID()));
+    }
+    {
+        std::lock_guard<std::mutex> lck(evenly.mutex);
+        REQUIRE(0 == cluon::extractMessage<cluon::data::TimeStamp>(cluon::data::Envelope{evenly.envelopes.front()}).microseconds());
+        const int64_t START{cluon::time::toMicroseconds(evenly.envelopes.front().received())};
+        for (std::size_t i{1}; i < evenly.envelopes.size(); i++) {
+            // The k-th delivered Envelope is not received before k periods.
+            REQUIRE(START + static_cast<int64_t>(i) * PERIOD <= cluon::time::toMicroseconds(evenly.envelopes[i].received()));
+        }
+    }
+}
+
+TEST_CASE("Create OD4 session with priority classes to dispatch high-priority Envelopes ahead of bulk data.") {
+    using namespace std::literals::chrono_literals; // NOLINT
+    constexpr int32_t BULK{1001};
+    constexpr int32_t CONTROL{1002};
+    constexpr int32_t MAX_BULK_ENVELOPES{100};
+
+    // Latency of a high-priority Envelope that is sent right after a burst of bulk Envelopes with a slow delegate.
+    auto measureLatency = [&](bool usePriorityClasses) {
+        std::atomic<int32_t> bulkReceived{0};
+        std::atomic<int64_t> latency{-1};
+
+        cluon::OD4Session od4(96);
+        do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+        if (usePriorityClasses) {
+            REQUIRE(!od4.setPriority(CONTROL, cluon::OD4Session::Priority::HIGH, 64));
+            REQUIRE(od4.setPriority(CONTROL, cluon::OD4Session::Priority::HIGH, 46));
+        }
+        REQUIRE(od4.dataTrigger(BULK, [&bulkReceived](cluon::data::Envelope &&) {
+            // Simulate a slow consumer for bulk data.
+            std::this_thread::sleep_for(2ms);
+            bulkReceived++;
+        }));
+        REQUIRE(od4.dataTrigger(CONTROL, [&latency](cluon::data::Envelope &&envelope) {
+            latency.store(cluon::time::deltaInMicroseconds(cluon::time::now(), envelope.sent()));
+        }));
+
+        cluon::UDPSender sender{"225.0.0.96", 12175};
+        for (int32_t i{0}; i < MAX_BULK_ENVELOPES; i++) {
+            cluon::data::Envelope env;
+            env.dataType(BULK).serializedData(std::string(512, 'x')).sent(cluon::time::now());
+            sender.send(cluon::serializeEnvelope(std::move(env)));
+        }
+        cluon::data::Envelope env;
+        env.dataType(CONTROL).sent(cluon::time::now());
+        sender.send(cluon::serializeEnvelope(std::move(env)), (usePriorityClasses ? 46 : 0));
+
+        int32_t maxWaitingIn10Milliseconds{500};
+        do { std::this_thread::sleep_for(10ms); } while (((0 > latency.load()) || (MAX_BULK_ENVELOPES > bulkReceived.load())) && (maxWaitingIn10Milliseconds-- > 0));
+        REQUIRE(MAX_BULK_ENVELOPES == bulkReceived.load());
+        return latency.load();
+    };
+
+    const int64_t LATENCY_WITHOUT_PRIORITY_CLASSES{measureLatency(false)};
+    const int64_t LATENCY_WITH_PRIORITY_CLASSES{measureLatency(true)};
+    std::clog << "Latency of a high-priority Envelope after " << MAX_BULK_ENVELOPES << " bulk Envelopes: " << LATENCY_WITHOUT_PRIORITY_CLASSES
+              << " microseconds without and " << LATENCY_WITH_PRIORITY_CLASSES << " microseconds with priority classes." << std::endl;
+
+    // Without priority classes, the Envelope waits for the bulk delegates (100 x 2 ms).
+    REQUIRE(100 * 1000 < LATENCY_WITHOUT_PRIORITY_CLASSES);
+    REQUIRE(0 <= LATENCY_WITH_PRIORITY_CLASSES);
+    REQUIRE(50 * 1000 > LATENCY_WITH_PRIORITY_CLASSES);
+}
+
+TEST_CASE("Create OD4 session with dataTriggers that are applied as socket filter.") {
+    using namespace std::literals::chrono_literals; // NOLINT
+    std::mutex receivedMutex;
+    std::vector<int32_t> received;
+    auto receive = [&receivedMutex, &received](cluon::data::Envelope &&envelope) {
+        std::lock_guard<std::mutex> lck(receivedMutex);
+        received.push_back(envelope.dataType());
+    };
+
+    cluon::OD4Session od4(97);
+    do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+    // dataTypes with one- and multi-byte varints as well as negative ones.
+    REQUIRE(od4.dataTrigger(cluon::data::TimeStamp::ID(), receive));
+    REQUIRE(od4.dataTrigger(300000, receive));
+    REQUIRE(od4.dataTrigger(-5, receive));
+
+    cluon::UDPSender sender{"225.0.0.97", 12175};
+    auto sendAndReceive = [&](const std::vector<int32_t> &listOfDataTypes, std::size_t expected) {
+        {
+            std::lock_guard<std::mutex> lck(receivedMutex);
+            received.clear();
+        }
+        for (auto dataType : listOfDataTypes) {
+            cluon::data::Envelope env;
+            env.dataType(dataType).sent(cluon::time::now());
+            sender.send(cluon::serializeEnvelope(std::move(env)));
+        }
+        // Non-OD4 data passes the filter and is discarded in user space.
+        sender.send("Hello World");
+
+        int32_t maxWaitingIn10Milliseconds{100};
+        do {
+            std::this_thread::sleep_for(10ms);
+            std::lock_guard<std::mutex> lck(receivedMutex);
+            if (expected == received.size()) {
+                break;
+            }
+        } while (maxWaitingIn10Milliseconds-- > 0);
+        std::this_thread::sleep_for(50ms);
+        std::lock_guard<std::mutex> lck(receivedMutex);
+        return received;
+    };
+
+    const std::vector<int32_t> LIST_OF_DATATYPES{0, cluon::data::TimeStamp::ID() + 1, -5, 299999, 300000, -6, cluon::data::TimeStamp::ID(), 300001};
+    REQUIRE((std::vector<int32_t>{-5, 300000, cluon::data::TimeStamp::ID()}) == sendAndReceive(LIST_OF_DATATYPES, 3));
+
+    // Changing the subscriptions updates the socket filter.
+    REQUIRE(od4.dataTrigger(300000, nullptr));
+    REQUIRE(od4.dataTrigger(0, receive));
+    REQUIRE((std::vector<int32_t>{0, -5, cluon::data::TimeStamp::ID()}) == sendAndReceive(LIST_OF_DATATYPES, 3));
+
+    // The monitor needs all Envelopes.
+    od4.enableMonitor();
+    sendAndReceive(LIST_OF_DATATYPES, 3);
+    REQUIRE(LIST_OF_DATATYPES.size() == od4.statistics().size());
+}
+
+TEST_CASE("Create OD4 sessions with topic partitioning that keep working with single-group peers.") {
+    using namespace std::literals::chrono_literals; // NOLINT
+    REQUIRE("225.0.0.98" == cluon::OD4Session::multicastGroup(98, 10, 0));
+    REQUIRE("225.1.2.98" == cluon::OD4Session::multicastGroup(98, 10, 4));
+    REQUIRE("225.1.3.98" == cluon::OD4Session::multicastGroup(98, -1, 4));
+
+    std::mutex receivedMutex;
+    std::vector<uint32_t> received;
+    auto waitFor = [&receivedMutex, &received](std::size_t expected) {
+        int32_t maxWaitingIn10Milliseconds{100};
+        do {
+            std::this_thread::sleep_for(10ms);
+            std::lock_guard<std::mutex> lck(receivedMutex);
+            if (expected <= received.size()) {
+                break;
+            }
+        } while (maxWaitingIn10Milliseconds-- > 0);
+        std::this_thread::sleep_for(50ms);
+        std::lock_guard<std::mutex> lck(receivedMutex);
+        std::vector<uint32_t> retVal{received};
+        received.clear();
+        return retVal;
+    };
+
+    cluon::OD4Session od4(98);
+    do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+    REQUIRE(!od4.enableTopicPartitioning(0));
+    REQUIRE(od4.enableTopicPartitioning(4));
+    REQUIRE(!od4.enableTopicPartitioning(8));
+    REQUIRE(od4.dataTrigger(cluon::data::TimeStamp::ID(), [&receivedMutex, &received](cluon::data::Envelope &&envelope) {
+        std::lock_guard<std::mutex> lck(receivedMutex);
+        received.push_back(envelope.senderStamp());
+    }));
+
+    auto envelope = [](uint32_t senderStamp) {
+        cluon::data::Envelope env;
+        env.dataType(cluon::data::TimeStamp::ID()).senderStamp(senderStamp).sent(cluon::time::now());
+        return env;
+    };
+
+    // Envelopes are received from the partition group of their dataType only.
+    cluon::UDPSender sender{"225.0.0.98", 12175};
+    const std::string GROUP{cluon::OD4Session::multicastGroup(98, cluon::data::TimeStamp::ID(), 4)};
+    const std::string OTHER_GROUP{cluon::OD4Session::multicastGroup(98, cluon::data::TimeStamp::ID() + 1, 4)};
+    sender.sendTo(cluon::serializeEnvelope(envelope(1), 0, 0, 4), GROUP, 12175);
+    sender.sendTo(cluon::serializeEnvelope(envelope(2), 0, 0, 4), OTHER_GROUP, 12175);
+    REQUIRE((std::vector<uint32_t>{1}) == waitFor(1));
+
+    // Single-group peers are received; copies from partitioned peers with the same number of partitions are ignored.
+    sender.send(cluon::serializeEnvelope(envelope(3), 0, 0, 4));
+    sender.send(cluon::serializeEnvelope(envelope(4), 0, 0, 0));
+    sender.send(cluon::serializeEnvelope(envelope(5), 0, 0, 8));
+    REQUIRE((std::vector<uint32_t>{4, 5}) == waitFor(2));
+
+    // A partitioned OD4Session sends to the single group only while single-group peers are sending.
+    std::atomic<uint32_t> receivedFromSingleGroup{0};
+    std::atomic<uint32_t> receivedFromPartitionGroup{0};
+    cluon::UDPReceiver singleGroup{"225.0.0.98", 12175, [&receivedFromSingleGroup](std::string &&, std::string &&, std::chrono::system_clock::time_point &&) {
+                                       receivedFromSingleGroup++;
+                                   }};
+    cluon::UDPReceiver partitionGroup{GROUP, 12175, [&receivedFromPartitionGroup](std::string &&, std::string &&, std::chrono::system_clock::time_point &&) {
+                                          receivedFromPartitionGroup++;
+                                      }};
+    cluon::OD4Session od4ToSendFrom(98);
+    do { std::this_thread::sleep_for(1ms); } while (!od4ToSendFrom.isRunning());
+    REQUIRE(od4ToSendFrom.enableTopicPartitioning(4));
+
+    cluon::data::TimeStamp ts;
+    od4ToSendFrom.send(ts, cluon::data::TimeStamp(), 6);
+    // od4 receives the Envelope in-process.
+    REQUIRE((std::vector<uint32_t>{6}) == waitFor(1));
+    REQUIRE(1 == receivedFromPartitionGroup.load());
+    REQUIRE(0 == receivedFromSingleGroup.load());
+
+    sender.send(cluon::serializeEnvelope(envelope(7)));
+    REQUIRE((std::vector<uint32_t>{7}) == waitFor(1));
+    receivedFromSingleGroup.store(0);
+    od4ToSendFrom.send(ts, cluon::data::TimeStamp(), 8);
+    REQUIRE((std::vector<uint32_t>{8}) == waitFor(1));
+    REQUIRE(2 == receivedFromPartitionGroup.load());
+    REQUIRE(1 == receivedFromSingleGroup.load());
+}
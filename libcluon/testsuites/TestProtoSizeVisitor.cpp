@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon/ProtoSizeVisitor.hpp"
+#include "cluon/ToProtoVisitor.hpp"
+#include "cluon/cluonDataStructures.hpp"
+#include "cluon/cluonTestDataStructures.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+TEST_CASE("Testing size of VarInts.") {
+    REQUIRE(1 == cluon::ProtoSizeVisitor::varIntSize(0));
+    REQUIRE(1 == cluon::ProtoSizeVisitor::varIntSize(127));
+    REQUIRE(2 == cluon::ProtoSizeVisitor::varIntSize(128));
+    REQUIRE(2 == cluon::ProtoSizeVisitor::varIntSize(16383));
+    REQUIRE(3 == cluon::ProtoSizeVisitor::varIntSize(16384));
+    REQUIRE(10 == cluon::ProtoSizeVisitor::varIntSize(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST_CASE("Testing ProtoSizeVisitor with MyTestMessage5.") {
+    testdata::MyTestMessage5 tmp;
+    tmp.attribute1(3).attribute2(-3).attribute3(103).attribute4(-103).attribute5(10003).attribute6(-10003);
+    tmp.attribute7(54321).attribute8(-74321).attribute9(-5.4321f).attribute10(-5.4321).attribute11(std::string(300, 'x'));
+
+    cluon::ProtoSizeVisitor protoSize;
+    tmp.accept(protoSize);
+
+    cluon::ToProtoVisitor protoEncoder;
+    tmp.accept(protoEncoder);
+    REQUIRE(protoEncoder.size() == protoSize.size());
+}
+
+TEST_CASE("Testing ProtoSizeVisitor with nested messages.") {
+    testdata::MyTestMessage7 tmp7;
+    testdata::MyTestMessage2 tmp2_1;
+    tmp7.attribute1(tmp2_1.attribute1(150));
+    tmp7.attribute2(12);
+
+    cluon::ProtoSizeVisitor protoSize;
+    tmp7.accept(protoSize);
+    REQUIRE(11 == protoSize.size());
+
+    cluon::ToProtoVisitor protoEncoder;
+    tmp7.accept(protoEncoder);
+    REQUIRE(protoEncoder.size() == protoSize.size());
+}
+
+TEST_CASE("Testing ProtoSizeVisitor with Envelope.") {
+    cluon::data::Envelope env;
+    env.dataType(1234).serializedData(std::string(200, 'y')).senderStamp(42);
+    cluon::data::TimeStamp ts;
+    ts.seconds(1500000000).microseconds(123456);
+    env.sent(ts).received(ts).sampleTimeStamp(ts);
+
+    cluon::ProtoSizeVisitor protoSize;
+    env.accept(protoSize);
+
+    cluon::ToProtoVisitor protoEncoder;
+    env.accept(protoEncoder);
+    REQUIRE(protoEncoder.size() == protoSize.size());
+}
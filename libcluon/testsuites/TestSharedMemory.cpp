@@ -16,17 +16,21 @@
 #ifndef WIN32
   #include <fcntl.h>
   #include <sys/stat.h>
+  #include <sys/wait.h>
   #include <unistd.h>
 #endif
 // clang-format on
 
+#include <atomic>
 #include <cstring>
 #include <chrono>
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 TEST_CASE("Testing time-stamps on files for POSIX using file descriptors.") {
 #if !defined(__APPLE__) && !defined(WIN32) && defined(__amd64__) && defined(__linux__)
@@ -1437,3 +1441,480 @@ TEST_CASE("Trying to create SharedMemory with correct name and one separate thre
     putenv(const_cast<char *>((usePOSIX ? "CLUON_SHAREDMEMORY_POSIX=1" : "CLUON_SHAREDMEMORY_POSIX=0")));
 #endif
 }
+
+TEST_CASE("Trying to read SharedMemory lock-free while a separate thread is writing (POSIX and SysV).") {
+#if defined(__linux__) && defined(__GLIBC__)
+    const char *CLUON_SHAREDMEMORY_POSIX = getenv("CLUON_SHAREDMEMORY_POSIX");
+    bool usePOSIX                        = ((nullptr != CLUON_SHAREDMEMORY_POSIX) && (CLUON_SHAREDMEMORY_POSIX[0] == '1'));
+    for (auto backend : {"CLUON_SHAREDMEMORY_POSIX=1", "CLUON_SHAREDMEMORY_POSIX=0"}) {
+        putenv(const_cast<char *>(backend));
+        constexpr uint32_t SIZE{64 * 1024};
+        cluon::SharedMemory sm1{"/SEQLOCK", SIZE};
+        REQUIRE(sm1.valid());
+        REQUIRE(SIZE == sm1.size());
+        REQUIRE(0 == sm1.sequence());
+
+        cluon::SharedMemory sm2{"/SEQLOCK"};
+        REQUIRE(sm2.valid());
+        REQUIRE(SIZE == sm2.size());
+
+        // The writer only needs the sequence counter to announce modifications.
+        sm1.lock();
+        sm1.beginWrite();
+        REQUIRE(1 == sm2.sequence());
+        REQUIRE(!sm2.read([](const char *, uint32_t) {}, 10));
+        std::memset(sm1.data(), 'a', SIZE);
+        sm1.endWrite();
+        sm1.unlock();
+        REQUIRE(2 == sm2.sequence());
+
+        std::string copy;
+        REQUIRE(sm2.read([&copy](const char *data, uint32_t size) { copy.assign(data, size); }));
+        REQUIRE(std::string(SIZE, 'a') == copy);
+
+        // Every consistent read must see one value only.
+        std::atomic<bool> running{true};
+        std::thread writer([&sm1, &running]() noexcept {
+            char c{'a'};
+            while (running.load()) {
+                c = static_cast<char>('a' + (c - 'a' + 1) % 26);
+                sm1.beginWrite();
+                std::memset(sm1.data(), c, SIZE);
+                sm1.endWrite();
+            }
+        });
+
+        uint32_t consistentReads{0};
+        for (uint32_t i{0}; i < 1000; i++) {
+            if (sm2.read([&copy](const char *data, uint32_t size) { copy.assign(data, size); })) {
+                consistentReads++;
+                REQUIRE(std::string(SIZE, copy[0]) == copy);
+            }
+        }
+        running.store(false);
+        writer.join();
+
+        REQUIRE(0 < consistentReads);
+        REQUIRE(2 < sm2.sequence());
+        REQUIRE(0 == sm2.sequence() % 2);
+    }
+    putenv(const_cast<char *>((usePOSIX ? "CLUON_SHAREDMEMORY_POSIX=1" : "CLUON_SHAREDMEMORY_POSIX=0")));
+#endif
+}
+
+TEST_CASE("Trying to create SharedMemory with slots and read the newest and the next slots (POSIX and SysV).") {
+#if defined(__linux__) && defined(__GLIBC__)
+    const char *CLUON_SHAREDMEMORY_POSIX = getenv("CLUON_SHAREDMEMORY_POSIX");
+    bool usePOSIX                        = ((nullptr != CLUON_SHAREDMEMORY_POSIX) && (CLUON_SHAREDMEMORY_POSIX[0] == '1'));
+    for (auto backend : {"CLUON_SHAREDMEMORY_POSIX=1", "CLUON_SHAREDMEMORY_POSIX=0"}) {
+        putenv(const_cast<char *>(backend));
+        cluon::SharedMemory sm1{"/SLOTS", 100, 3};
+        REQUIRE(sm1.valid());
+        REQUIRE(3 == sm1.numberOfSlots());
+        REQUIRE(100 == sm1.slotSize());
+        REQUIRE(3 * 100 <= sm1.size());
+
+        // Attaching uses the layout of the existing slots.
+        cluon::SharedMemory sm2{"/SLOTS"};
+        REQUIRE(sm2.valid());
+        REQUIRE(3 == sm2.numberOfSlots());
+        REQUIRE(100 == sm2.slotSize());
+
+        std::string copy;
+        cluon::data::TimeStamp sampleTimeStamp;
+        auto delegate = [&copy, &sampleTimeStamp](const char *data, uint32_t size, const cluon::data::TimeStamp &ts) {
+            copy.assign(data, size);
+            sampleTimeStamp = ts;
+        };
+        REQUIRE(!sm2.readSlot(delegate));
+
+        // Publishing a slot requires to begin writing it.
+        sm1.endWriteSlot(1, cluon::data::TimeStamp{});
+        REQUIRE(!sm2.readSlot(delegate));
+
+        auto write = [&sm1](const std::string &s, int32_t seconds) {
+            char *slot = sm1.beginWriteSlot();
+            REQUIRE(nullptr != slot);
+            std::memcpy(slot, s.data(), s.size());
+            cluon::data::TimeStamp ts;
+            ts.seconds(seconds).microseconds(seconds * 2);
+            sm1.endWriteSlot(static_cast<uint32_t>(s.size()), ts);
+        };
+        for (int32_t i{0}; i < 5; i++) { write("Frame " + std::to_string(i), i); }
+
+        // The two oldest frames were overwritten.
+        REQUIRE(sm2.readSlot(delegate, cluon::SharedMemory::SlotSelection::NEXT));
+        REQUIRE("Frame 2" == copy);
+        REQUIRE(2 == sampleTimeStamp.seconds());
+        REQUIRE(4 == sampleTimeStamp.microseconds());
+        REQUIRE(sm2.readSlot(delegate, cluon::SharedMemory::SlotSelection::NEXT));
+        REQUIRE("Frame 3" == copy);
+        REQUIRE(sm2.readSlot(delegate, cluon::SharedMemory::SlotSelection::NEXT));
+        REQUIRE("Frame 4" == copy);
+        REQUIRE(!sm2.readSlot(delegate, cluon::SharedMemory::SlotSelection::NEXT));
+
+        write("Frame 5", 5);
+        write("Frame 6", 6);
+        REQUIRE(sm2.readSlot(delegate, cluon::SharedMemory::SlotSelection::NEWEST));
+        REQUIRE("Frame 6" == copy);
+        REQUIRE(6 == sampleTimeStamp.seconds());
+        REQUIRE(!sm2.readSlot(delegate, cluon::SharedMemory::SlotSelection::NEWEST));
+
+        // The producer never waits for the consumer and every consumed slot is consistent.
+        std::atomic<bool> running{true};
+        std::thread producer([&sm1, &running]() noexcept {
+            char c{'a'};
+            while (running.load()) {
+                c = static_cast<char>('a' + (c - 'a' + 1) % 26);
+                char *slot = sm1.beginWriteSlot();
+                std::memset(slot, c, 100);
+                sm1.endWriteSlot(100, cluon::data::TimeStamp{});
+            }
+        });
+        uint32_t consumed{0};
+        const auto DEADLINE{std::chrono::steady_clock::now() + std::chrono::seconds(5)};
+        for (uint32_t i{0}; (consumed < 100) && (std::chrono::steady_clock::now() < DEADLINE); i++) {
+            if (sm2.readSlot(delegate, (0 == i % 2) ? cluon::SharedMemory::SlotSelection::NEWEST : cluon::SharedMemory::SlotSelection::NEXT)) {
+                consumed++;
+                REQUIRE(std::string(100, copy[0]) == copy);
+            }
+        }
+        running.store(false);
+        producer.join();
+        REQUIRE(0 < consumed);
+    }
+    {
+        cluon::SharedMemory sm3{"/NOSLOTS", 100};
+        REQUIRE(sm3.valid());
+        REQUIRE(0 == sm3.numberOfSlots());
+        REQUIRE(nullptr == sm3.beginWriteSlot());
+        REQUIRE(!sm3.readSlot([](const char *, uint32_t, const cluon::data::TimeStamp &) {}));
+    }
+    {
+        cluon::SharedMemory sm4{"/TOOMANYSLOTS", 1024 * 1024, 8192};
+        REQUIRE(!sm4.valid());
+    }
+    putenv(const_cast<char *>((usePOSIX ? "CLUON_SHAREDMEMORY_POSIX=1" : "CLUON_SHAREDMEMORY_POSIX=0")));
+#endif
+}
+
+TEST_CASE("Trying to wait on SharedMemory with timeout (POSIX and SysV).") {
+#if defined(__linux__) && defined(__GLIBC__)
+    const char *CLUON_SHAREDMEMORY_POSIX = getenv("CLUON_SHAREDMEMORY_POSIX");
+    bool usePOSIX                        = ((nullptr != CLUON_SHAREDMEMORY_POSIX) && (CLUON_SHAREDMEMORY_POSIX[0] == '1'));
+    for (auto backend : {"CLUON_SHAREDMEMORY_POSIX=1", "CLUON_SHAREDMEMORY_POSIX=0"}) {
+        putenv(const_cast<char *>(backend));
+        cluon::SharedMemory sm1{"/TIMEDWAIT", 4};
+        REQUIRE(sm1.valid());
+
+        // Timeout without notification.
+        {
+            const auto BEFORE{std::chrono::steady_clock::now()};
+            REQUIRE(!sm1.waitFor(std::chrono::milliseconds(50)));
+            const auto DURATION{std::chrono::steady_clock::now() - BEFORE};
+            REQUIRE(std::chrono::milliseconds(50) <= DURATION);
+            REQUIRE(DURATION < std::chrono::seconds(5));
+            REQUIRE(!sm1.waitUntil(std::chrono::steady_clock::now() - std::chrono::milliseconds(1)));
+            REQUIRE(sm1.valid());
+        }
+
+        // Notification from another thread.
+        {
+            std::atomic<bool> running{true};
+            std::thread producer([&running]() noexcept {
+                cluon::SharedMemory sm2{"/TIMEDWAIT"};
+                while (running.load()) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    sm2.notifyAll();
+                }
+            });
+            const auto BEFORE{std::chrono::steady_clock::now()};
+            REQUIRE(sm1.waitFor(std::chrono::seconds(10)));
+            REQUIRE(std::chrono::steady_clock::now() - BEFORE < std::chrono::seconds(5));
+            running.store(false);
+            producer.join();
+            REQUIRE(sm1.valid());
+        }
+    }
+    putenv(const_cast<char *>((usePOSIX ? "CLUON_SHAREDMEMORY_POSIX=1" : "CLUON_SHAREDMEMORY_POSIX=0")));
+#endif
+}
+
+TEST_CASE("Trying to lock SharedMemory whose owner terminated while holding the lock (POSIX).") {
+#if defined(__linux__) && defined(__GLIBC__)
+    const char *CLUON_SHAREDMEMORY_POSIX = getenv("CLUON_SHAREDMEMORY_POSIX");
+    bool usePOSIX                        = ((nullptr != CLUON_SHAREDMEMORY_POSIX) && (CLUON_SHAREDMEMORY_POSIX[0] == '1'));
+    putenv(const_cast<char *>("CLUON_SHAREDMEMORY_POSIX=1"));
+    {
+        cluon::SharedMemory sm1{"/ROBUST", 4};
+        REQUIRE(sm1.valid());
+
+        // The thread terminates without unlocking the shared memory.
+        std::thread owner([&sm1]() noexcept { sm1.lock(); });
+        owner.join();
+
+        sm1.lock();
+        REQUIRE(sm1.valid());
+        sm1.unlock();
+        sm1.lock();
+        REQUIRE(sm1.valid());
+        sm1.unlock();
+    }
+    putenv(const_cast<char *>((usePOSIX ? "CLUON_SHAREDMEMORY_POSIX=1" : "CLUON_SHAREDMEMORY_POSIX=0")));
+#endif
+}
+
+TEST_CASE("Trying to read time stamp and frame counter from SharedMemory header without locking (POSIX and SysV).") {
+#if defined(__linux__) && defined(__GLIBC__)
+    const char *CLUON_SHAREDMEMORY_POSIX = getenv("CLUON_SHAREDMEMORY_POSIX");
+    bool usePOSIX                        = ((nullptr != CLUON_SHAREDMEMORY_POSIX) && (CLUON_SHAREDMEMORY_POSIX[0] == '1'));
+    for (auto backend : {"CLUON_SHAREDMEMORY_POSIX=1", "CLUON_SHAREDMEMORY_POSIX=0"}) {
+        putenv(const_cast<char *>(backend));
+        cluon::SharedMemory sm1{"/FRAMES", 4};
+        REQUIRE(sm1.valid());
+        cluon::SharedMemory sm2{"/FRAMES"};
+        REQUIRE(sm2.valid());
+        REQUIRE(0 == sm2.frameCounter());
+        REQUIRE(0 == sm2.sampleTimeStamp().seconds());
+
+        cluon::data::TimeStamp ts;
+        ts.seconds(1234567).microseconds(999999);
+        REQUIRE(!sm1.setTimeStamp(ts));
+        REQUIRE(0 == sm2.frameCounter());
+
+        for (int32_t i{1}; i <= 3; i++) {
+            sm1.lock();
+            sm1.beginWrite();
+            *reinterpret_cast<int32_t *>(sm1.data()) = i;
+            ts.seconds(1234567 + i);
+            REQUIRE(sm1.setTimeStamp(ts));
+            sm1.endWrite();
+            sm1.unlock();
+        }
+        REQUIRE(3 == sm2.frameCounter());
+
+        int32_t value{0};
+        cluon::data::TimeStamp sampleTimeStamp;
+        REQUIRE(sm2.read([&value, &sampleTimeStamp, &sm2](const char *data, uint32_t) {
+            value           = *reinterpret_cast<const int32_t *>(data);
+            sampleTimeStamp = sm2.sampleTimeStamp();
+        }));
+        REQUIRE(3 == value);
+        REQUIRE(1234570 == sampleTimeStamp.seconds());
+        REQUIRE(999999 == sampleTimeStamp.microseconds());
+
+        REQUIRE(!sm2.getTimeStamp().first);
+        sm2.lock();
+        auto r = sm2.getTimeStamp();
+        sm2.unlock();
+        REQUIRE(r.first);
+        REQUIRE(1234570 == r.second.seconds());
+        REQUIRE(999999 == r.second.microseconds());
+    }
+    putenv(const_cast<char *>((usePOSIX ? "CLUON_SHAREDMEMORY_POSIX=1" : "CLUON_SHAREDMEMORY_POSIX=0")));
+#endif
+}
+
+TEST_CASE("Trying to create SharedMemory with options for alignment, prefaulting, locking, and huge pages (POSIX and SysV).") {
+#if defined(__linux__) && defined(__GLIBC__)
+    const char *CLUON_SHAREDMEMORY_POSIX = getenv("CLUON_SHAREDMEMORY_POSIX");
+    bool usePOSIX                        = ((nullptr != CLUON_SHAREDMEMORY_POSIX) && (CLUON_SHAREDMEMORY_POSIX[0] == '1'));
+    for (auto backend : {"CLUON_SHAREDMEMORY_POSIX=1", "CLUON_SHAREDMEMORY_POSIX=0"}) {
+        putenv(const_cast<char *>(backend));
+        for (uint32_t alignment : {64u, 4096u, 100u}) {
+            cluon::SharedMemory::Options options;
+            options.populate  = true;
+            options.lock      = true;
+            options.hugePages = true;
+            options.alignment = alignment;
+            // Invalid alignments fall back to 64 bytes.
+            const uint32_t EXPECTED_ALIGNMENT{(100u == alignment) ? 64u : alignment};
+
+            cluon::SharedMemory sm1{"/OPTIONS", 10000, 0, options};
+            REQUIRE(sm1.valid());
+            REQUIRE(10000 == sm1.size());
+            REQUIRE(0 == reinterpret_cast<uintptr_t>(sm1.data()) % EXPECTED_ALIGNMENT);
+            sm1.lock();
+            sm1.data()[0]    = 'A';
+            sm1.data()[9999] = 'Z';
+            sm1.unlock();
+
+            cluon::SharedMemory sm2{"/OPTIONS"};
+            REQUIRE(sm2.valid());
+            REQUIRE(10000 == sm2.size());
+            REQUIRE(0 == reinterpret_cast<uintptr_t>(sm2.data()) % EXPECTED_ALIGNMENT);
+            sm2.lock();
+            REQUIRE('A' == sm2.data()[0]);
+            REQUIRE('Z' == sm2.data()[9999]);
+            sm2.unlock();
+        }
+    }
+    putenv(const_cast<char *>((usePOSIX ? "CLUON_SHAREDMEMORY_POSIX=1" : "CLUON_SHAREDMEMORY_POSIX=0")));
+#endif
+}
+
+TEST_CASE("Trying to wait on SharedMemory with futex-based notifications (POSIX and SysV).") {
+#if defined(__linux__) && defined(__GLIBC__)
+    const char *CLUON_SHAREDMEMORY_POSIX = getenv("CLUON_SHAREDMEMORY_POSIX");
+    bool usePOSIX                        = ((nullptr != CLUON_SHAREDMEMORY_POSIX) && (CLUON_SHAREDMEMORY_POSIX[0] == '1'));
+    for (auto backend : {"CLUON_SHAREDMEMORY_POSIX=1", "CLUON_SHAREDMEMORY_POSIX=0"}) {
+        putenv(const_cast<char *>(backend));
+        cluon::SharedMemory::Options options;
+        options.futex = true;
+        cluon::SharedMemory sm1{"/FUTEX", 4, 0, options};
+        REQUIRE(sm1.valid());
+        cluon::SharedMemory sm2{"/FUTEX"};
+        REQUIRE(sm2.valid());
+
+        REQUIRE(!sm2.waitFor(std::chrono::milliseconds(10)));
+
+        std::atomic<bool> woken{false};
+        std::thread waiter([&sm2, &woken]() noexcept {
+            sm2.wait();
+            woken.store(true);
+        });
+        // The waiter might not be waiting yet; hence, notify repeatedly.
+        const auto DEADLINE{std::chrono::steady_clock::now() + std::chrono::seconds(5)};
+        while (!woken.load() && (std::chrono::steady_clock::now() < DEADLINE)) {
+            sm1.notifyAll();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        waiter.join();
+        REQUIRE(woken.load());
+
+        std::thread notifier([&sm2]() noexcept {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            sm2.notifyAll();
+        });
+        REQUIRE(sm1.waitFor(std::chrono::seconds(5)));
+        notifier.join();
+    }
+    putenv(const_cast<char *>((usePOSIX ? "CLUON_SHAREDMEMORY_POSIX=1" : "CLUON_SHAREDMEMORY_POSIX=0")));
+#endif
+}
+
+TEST_CASE("Trying to register readers with SharedMemory and to inspect their lag and missed frames (POSIX and SysV).") {
+#if defined(__linux__) && defined(__GLIBC__)
+    const char *CLUON_SHAREDMEMORY_POSIX = getenv("CLUON_SHAREDMEMORY_POSIX");
+    bool usePOSIX                        = ((nullptr != CLUON_SHAREDMEMORY_POSIX) && (CLUON_SHAREDMEMORY_POSIX[0] == '1'));
+    for (auto backend : {"CLUON_SHAREDMEMORY_POSIX=1", "CLUON_SHAREDMEMORY_POSIX=0"}) {
+        putenv(const_cast<char *>(backend));
+        {
+            // Slots.
+            cluon::SharedMemory producer{"/READERS", 4, 3};
+            REQUIRE(producer.valid());
+            REQUIRE(producer.readers().empty());
+
+            cluon::SharedMemory fast{"/READERS"};
+            REQUIRE(fast.registerReader());
+            REQUIRE(fast.registerReader());
+            cluon::SharedMemory slow{"/READERS"};
+            REQUIRE(slow.registerReader());
+            REQUIRE(2 == producer.readers().size());
+
+            auto noop = [](const char *, uint32_t, const cluon::data::TimeStamp &) {};
+            for (uint32_t i{0}; i < 5; i++) {
+                producer.beginWriteSlot();
+                producer.endWriteSlot(4, cluon::data::TimeStamp());
+                REQUIRE(fast.readSlot(noop));
+            }
+            REQUIRE(0 == fast.missedFrames());
+
+            // Slots 0 and 1 were overwritten already.
+            REQUIRE(slow.readSlot(noop));
+            REQUIRE(2 == slow.missedFrames());
+
+            auto readers = producer.readers();
+            REQUIRE(2 == readers.size());
+            REQUIRE(5 == readers[0].cursor);
+            REQUIRE(0 == readers[0].lag);
+            REQUIRE(0 == readers[0].missedFrames);
+            REQUIRE(3 == readers[1].cursor);
+            REQUIRE(2 == readers[1].lag);
+            REQUIRE(2 == readers[1].missedFrames);
+            REQUIRE(0 < readers[1].heartbeat.seconds());
+
+            // The newest slot skips the remaining ones.
+            REQUIRE(slow.readSlot(noop, cluon::SharedMemory::SlotSelection::NEWEST));
+            REQUIRE(3 == slow.missedFrames());
+            REQUIRE(0 == producer.readers()[1].lag);
+
+            slow.unregisterReader();
+            REQUIRE(1 == producer.readers().size());
+        }
+        {
+            // Frames from setTimeStamp.
+            cluon::SharedMemory producer{"/READERS", 4};
+            REQUIRE(producer.valid());
+            cluon::SharedMemory reader{"/READERS"};
+            REQUIRE(reader.valid());
+
+            auto publish = [&producer]() {
+                producer.lock();
+                producer.beginWrite();
+                producer.setTimeStamp(cluon::data::TimeStamp());
+                producer.endWrite();
+                producer.unlock();
+            };
+            publish();
+            REQUIRE(reader.registerReader());
+            publish();
+            publish();
+            REQUIRE(2 == producer.readers()[0].lag);
+
+            REQUIRE(reader.read([](const char *, uint32_t) {}));
+            REQUIRE(1 == reader.missedFrames());
+            REQUIRE(reader.read([](const char *, uint32_t) {}));
+            REQUIRE(1 == reader.missedFrames());
+            REQUIRE(3 == producer.readers()[0].cursor);
+            REQUIRE(0 == producer.readers()[0].lag);
+        }
+        {
+            // Limited number of readers.
+            cluon::SharedMemory producer{"/READERS", 4};
+            REQUIRE(producer.valid());
+            std::vector<std::unique_ptr<cluon::SharedMemory>> readers;
+            for (uint32_t i{0}; i < cluon::SharedMemory::MAX_NUMBER_OF_READERS; i++) {
+                readers.emplace_back(new cluon::SharedMemory{"/READERS"});
+                REQUIRE(readers.back()->registerReader());
+            }
+            cluon::SharedMemory oneTooMany{"/READERS"};
+            REQUIRE(!oneTooMany.registerReader());
+            REQUIRE(0 == oneTooMany.missedFrames());
+            readers.pop_back();
+            REQUIRE(oneTooMany.registerReader());
+            REQUIRE(cluon::SharedMemory::MAX_NUMBER_OF_READERS == producer.readers().size());
+        }
+        {
+            // Entries of crashed readers are reused once their heartbeat timed out.
+            cluon::SharedMemory producer{"/READERS", 4};
+            REQUIRE(producer.valid());
+            const pid_t CHILD{::fork()};
+            if (0 == CHILD) {
+                cluon::SharedMemory crashingReader{"/READERS"};
+                ::_exit(crashingReader.registerReader() ? 0 : 1);
+            }
+            int status{-1};
+            REQUIRE(CHILD == ::waitpid(CHILD, &status, 0));
+            REQUIRE(0 == status);
+            REQUIRE(1 == producer.readers().size());
+
+            std::vector<std::unique_ptr<cluon::SharedMemory>> readers;
+            for (uint32_t i{1}; i < cluon::SharedMemory::MAX_NUMBER_OF_READERS; i++) {
+                readers.emplace_back(new cluon::SharedMemory{"/READERS"});
+                REQUIRE(readers.back()->registerReader());
+            }
+            // The crashed reader's process is gone but its heartbeat is recent.
+            cluon::SharedMemory lateReader{"/READERS"};
+            REQUIRE(!lateReader.registerReader());
+            std::this_thread::sleep_for(std::chrono::microseconds(cluon::SharedMemory::READER_TIMEOUT + 100 * 1000));
+            // Live readers keep their entries with a recent heartbeat.
+            for (auto &r : readers) { r->heartbeat(); }
+            REQUIRE(lateReader.registerReader());
+            REQUIRE(cluon::SharedMemory::MAX_NUMBER_OF_READERS == producer.readers().size());
+            for (const auto &r : producer.readers()) { REQUIRE(static_cast<uint32_t>(::getpid()) == r.processID); }
+        }
+    }
+    putenv(const_cast<char *>((usePOSIX ? "CLUON_SHAREDMEMORY_POSIX=1" : "CLUON_SHAREDMEMORY_POSIX=0")));
+#endif
+}
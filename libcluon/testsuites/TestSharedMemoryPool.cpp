@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon/SharedMemoryPool.hpp"
+
+#ifndef WIN32
+  #include <sys/wait.h>
+  #include <unistd.h>
+#endif
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+TEST_CASE("Trying to create SharedMemoryPool and access stored payloads from an attached pool.") {
+#ifndef WIN32
+    cluon::SharedMemoryPool owner{"/cluon-test-pool-1", 2, 1024};
+    REQUIRE(owner.valid());
+    REQUIRE(2 == owner.numberOfSlots());
+    REQUIRE(1024 == owner.slotSize());
+
+    cluon::SharedMemoryPool other{"/cluon-test-pool-1"};
+    REQUIRE(other.valid());
+    REQUIRE(2 == other.numberOfSlots());
+    REQUIRE(1024 == other.slotSize());
+
+    REQUIRE(0 == owner.store(std::string(1025, 'x')));
+    REQUIRE(0 == other.store("Not the owner"));
+
+    const uint64_t HELLO{owner.store("Hello")};
+    const uint64_t WORLD{owner.store("World")};
+    REQUIRE(0 != HELLO);
+    REQUIRE(0 != WORLD);
+    REQUIRE(HELLO != WORLD);
+
+    std::string data;
+    REQUIRE(other.access(HELLO, [&data](const char *d, uint32_t length) { data.assign(d, length); }));
+    REQUIRE("Hello" == data);
+    REQUIRE(other.access(WORLD, [&data](const char *d, uint32_t length) { data.assign(d, length); }));
+    REQUIRE("World" == data);
+
+    REQUIRE(!other.access(0, [](const char *, uint32_t) {}));
+    REQUIRE(!other.access(HELLO + 2, [](const char *, uint32_t) {}));
+    REQUIRE(!other.access(HELLO, nullptr));
+#endif
+}
+
+TEST_CASE("Trying to reuse slots of SharedMemoryPool only when they are not accessed.") {
+#ifndef WIN32
+    cluon::SharedMemoryPool owner{"/cluon-test-pool-2", 2, 1024};
+    REQUIRE(owner.valid());
+    cluon::SharedMemoryPool other{"/cluon-test-pool-2"};
+    REQUIRE(other.valid());
+
+    const uint64_t FIRST{owner.store("1")};
+    const uint64_t SECOND{owner.store("2")};
+
+    // Both payloads are pending for the attached instance; thus, no slot is free.
+    REQUIRE(0 != FIRST);
+    REQUIRE(0 != SECOND);
+    REQUIRE(0 == owner.store("3"));
+
+    // The oldest payload is replaced once it was accessed.
+    std::string data;
+    REQUIRE(other.access(FIRST, [&data](const char *d, uint32_t length) { data.assign(d, length); }));
+    REQUIRE("1" == data);
+    const uint64_t THIRD{owner.store("3")};
+    REQUIRE(0 != THIRD);
+    REQUIRE(!other.access(FIRST, [](const char *, uint32_t) {}));
+
+    // A payload that is accessed is not replaced; the other one is still pending.
+    uint64_t fourth{0};
+    REQUIRE(other.access(SECOND, [&owner, &data, &fourth](const char *d, uint32_t length) {
+        fourth = owner.store("4");
+        data.assign(d, length);
+    }));
+    REQUIRE("2" == data);
+    REQUIRE(0 == fourth);
+    const uint64_t FIFTH{owner.store("5")};
+    REQUIRE(0 != FIFTH);
+    REQUIRE(!other.access(SECOND, [](const char *, uint32_t) {}));
+
+    // Accessing a newer payload releases older payloads that were missed.
+    REQUIRE(other.access(FIFTH, [&data](const char *d, uint32_t length) { data.assign(d, length); }));
+    REQUIRE("5" == data);
+    REQUIRE(0 != owner.store("6"));
+    REQUIRE(!other.access(THIRD, [](const char *, uint32_t) {}));
+#endif
+}
+
+TEST_CASE("Trying to release payloads of SharedMemoryPool that are pending for a crashed reader.") {
+#ifndef WIN32
+    cluon::SharedMemoryPool owner{"/cluon-test-pool-3", 1, 1024};
+    REQUIRE(owner.valid());
+
+    pid_t pid = fork();
+    if (0 == pid) {
+        // Child process: Attach and terminate without detaching.
+        cluon::SharedMemoryPool other{"/cluon-test-pool-3"};
+        _exit(other.valid() ? 0 : 1);
+    }
+    REQUIRE(0 < pid);
+    int status{0};
+    REQUIRE(pid == waitpid(pid, &status, 0));
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(0 == WEXITSTATUS(status));
+
+    // The payload is kept for the crashed reader until its heartbeat timed out.
+    REQUIRE(0 != owner.store("1"));
+    REQUIRE(0 == owner.store("2"));
+    std::this_thread::sleep_for(std::chrono::microseconds(cluon::SharedMemoryPool::HEARTBEAT_TIMEOUT) + std::chrono::milliseconds(100));
+    REQUIRE(0 != owner.store("3"));
+#endif
+}
+
+TEST_CASE("Trying to use an attached SharedMemoryPool after its owner has gone.") {
+#ifndef WIN32
+    auto owner = std::make_unique<cluon::SharedMemoryPool>("/cluon-test-pool-4", 1, 1024);
+    REQUIRE(owner->valid());
+    cluon::SharedMemoryPool other{"/cluon-test-pool-4"};
+    REQUIRE(other.valid());
+
+    owner.reset();
+    REQUIRE(!other.valid());
+#endif
+}
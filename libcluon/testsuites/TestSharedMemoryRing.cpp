@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon/SharedMemoryRing.hpp"
+#include "cluon/UDPReceiver.hpp"
+#include "cluon/UDPSender.hpp"
+
+#ifndef WIN32
+  #include <sys/wait.h>
+  #include <unistd.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Trying to create SharedMemoryRing and exchange data between two subscribers.") {
+#ifndef WIN32
+    cluon::SharedMemoryRing producer{"/cluon-test-ring-1", 4, 1024};
+    REQUIRE(producer.valid());
+    REQUIRE(4 == producer.numberOfSlots());
+    REQUIRE(1024 == producer.slotSize());
+
+    // Attaching uses the layout of the existing ring.
+    cluon::SharedMemoryRing subscriber{"/cluon-test-ring-1", 8, 2048};
+    REQUIRE(subscriber.valid());
+    REQUIRE(4 == subscriber.numberOfSlots());
+    REQUIRE(1024 == subscriber.slotSize());
+
+    std::string data;
+    REQUIRE(!subscriber.pop(data, std::chrono::milliseconds(10)));
+
+    REQUIRE(producer.push("Hello"));
+    REQUIRE(producer.push("World"));
+    REQUIRE(!producer.push(std::string(1025, 'x')));
+
+    REQUIRE(subscriber.pop(data, std::chrono::milliseconds(10)));
+    REQUIRE("Hello" == data);
+    REQUIRE(0 < subscriber.producer());
+    REQUIRE(subscriber.pop(data, std::chrono::milliseconds(10)));
+    REQUIRE("World" == data);
+    REQUIRE(!subscriber.pop(data, std::chrono::milliseconds(10)));
+
+    // The producer is a subscriber as well.
+    REQUIRE(producer.pop(data, std::chrono::milliseconds(10)));
+    REQUIRE("Hello" == data);
+    REQUIRE(producer.pop(data, std::chrono::milliseconds(10)));
+    REQUIRE("World" == data);
+    REQUIRE(0 == subscriber.missed());
+    REQUIRE(0 == producer.missed());
+#endif
+}
+
+TEST_CASE("Trying to create SharedMemoryRing and wake up a waiting subscriber.") {
+#ifndef WIN32
+    cluon::SharedMemoryRing producer{"/cluon-test-ring-2", 4, 1024};
+    REQUIRE(producer.valid());
+
+    std::atomic<bool> received{false};
+    std::thread subscriberThread([&received]() {
+        cluon::SharedMemoryRing subscriber{"/cluon-test-ring-2", 0, 0};
+        REQUIRE(subscriber.valid());
+        std::string data;
+        while (!subscriber.pop(data, std::chrono::milliseconds(100))) {}
+        REQUIRE("Wake up" == data);
+        received.store(true);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    REQUIRE(producer.push("Wake up"));
+    subscriberThread.join();
+    REQUIRE(received.load());
+#endif
+}
+
+TEST_CASE("Trying to create SharedMemoryRing and count missed entries for a slow subscriber.") {
+#ifndef WIN32
+    cluon::SharedMemoryRing producer{"/cluon-test-ring-3", 4, 64};
+    REQUIRE(producer.valid());
+    cluon::SharedMemoryRing subscriber{"/cluon-test-ring-3", 0, 0};
+    REQUIRE(subscriber.valid());
+
+    for (uint32_t i{0}; i < 10; i++) { REQUIRE(producer.push(std::to_string(i))); }
+
+    std::string data;
+    REQUIRE(subscriber.pop(data, std::chrono::milliseconds(10)));
+    REQUIRE("6" == data);
+    REQUIRE(6 == subscriber.missed());
+    REQUIRE(subscriber.pop(data, std::chrono::milliseconds(10)));
+    REQUIRE("7" == data);
+    REQUIRE(subscriber.pop(data, std::chrono::milliseconds(10)));
+    REQUIRE("8" == data);
+    REQUIRE(subscriber.pop(data, std::chrono::milliseconds(10)));
+    REQUIRE("9" == data);
+    REQUIRE(!subscriber.pop(data, std::chrono::milliseconds(10)));
+    REQUIRE(6 == subscriber.missed());
+#endif
+}
+
+TEST_CASE("Trying to create SharedMemoryRing and register participants.") {
+#ifndef WIN32
+    cluon::SharedMemoryRing ring1{"/cluon-test-ring-4", 4, 64};
+    REQUIRE(ring1.valid());
+    cluon::SharedMemoryRing ring2{"/cluon-test-ring-4", 0, 0};
+    REQUIRE(ring2.valid());
+
+    REQUIRE(!ring1.addParticipant(0));
+    REQUIRE(!ring2.isParticipant(1234));
+    REQUIRE(ring1.addParticipant(1234));
+    REQUIRE(ring2.isParticipant(1234));
+    REQUIRE(!ring2.isParticipant(1235));
+    ring2.removeParticipant(1234);
+    REQUIRE(!ring1.isParticipant(1234));
+#endif
+}
+
+TEST_CASE("Trying to create SharedMemoryRing and remove participants of terminated processes.") {
+#ifndef WIN32
+    cluon::SharedMemoryRing ring{"/cluon-test-ring-9", 4, 64};
+    REQUIRE(ring.valid());
+    REQUIRE(ring.addParticipant(999));
+
+    // A terminated process leaves its participants behind and fills all entries.
+    const pid_t CHILD{::fork()};
+    if (0 == CHILD) {
+        bool added{true};
+        for (uint16_t id{1}; id < 64; id++) { added &= ring.addParticipant(id); }
+        ::_exit((added && !ring.addParticipant(64)) ? 0 : 1);
+    }
+    int status{-1};
+    REQUIRE(CHILD == ::waitpid(CHILD, &status, 0));
+    REQUIRE(0 == status);
+    REQUIRE(ring.isParticipant(1));
+    REQUIRE(!ring.addParticipant(4711));
+
+    // Waiting in pop refreshes the heartbeat of this process' participants.
+    std::string data;
+    REQUIRE(!ring.pop(data, std::chrono::milliseconds(2100)));
+    REQUIRE(ring.isParticipant(999));
+    REQUIRE(!ring.isParticipant(1));
+    REQUIRE(ring.addParticipant(4711));
+    REQUIRE(ring.isParticipant(4711));
+#endif
+}
+
+TEST_CASE("Trying to create SharedMemoryRing that outlives its creator.") {
+#ifndef WIN32
+    std::unique_ptr<cluon::SharedMemoryRing> creator{new cluon::SharedMemoryRing{"/cluon-test-ring-7", 4, 64}};
+    REQUIRE(creator->valid());
+    cluon::SharedMemoryRing subscriber{"/cluon-test-ring-7", 0, 0};
+    REQUIRE(subscriber.valid());
+    creator.reset();
+
+    // Later instances attach to the same ring instead of creating a new one.
+    cluon::SharedMemoryRing producer{"/cluon-test-ring-7", 8, 128};
+    REQUIRE(producer.valid());
+    REQUIRE(4 == producer.numberOfSlots());
+    REQUIRE(producer.push("Hello"));
+    std::string data;
+    REQUIRE(subscriber.pop(data, std::chrono::milliseconds(10)));
+    REQUIRE("Hello" == data);
+#endif
+}
+
+TEST_CASE("Trying to create SharedMemoryRing that is removed with its last subscriber.") {
+#ifndef WIN32
+    {
+        cluon::SharedMemoryRing ring1{"/cluon-test-ring-8", 4, 64};
+        REQUIRE(ring1.valid());
+        cluon::SharedMemoryRing ring2{"/cluon-test-ring-8", 0, 0};
+        REQUIRE(ring2.valid());
+    }
+    cluon::SharedMemoryRing ring{"/cluon-test-ring-8", 0, 0};
+    REQUIRE(!ring.valid());
+#endif
+}
+
+TEST_CASE("Trying to create SharedMemoryRing with invalid layout.") {
+#ifndef WIN32
+    cluon::SharedMemoryRing ring{"/cluon-test-ring-5", 0, 0};
+    REQUIRE(!ring.valid());
+    std::string data;
+    REQUIRE(!ring.push("Hello"));
+    REQUIRE(!ring.pop(data, std::chrono::milliseconds(1)));
+#endif
+}
+
+TEST_CASE("Measure performance of SharedMemoryRing vs. UDP multicast on loopback.") {
+#if defined(__amd64__) && defined(__linux__)
+    const std::vector<uint32_t> SIZES{64, 1024, 16 * 1024, 60 * 1024, 1024 * 1024, 4 * 1024 * 1024};
+    constexpr uint32_t ITERATIONS{200};
+
+    for (auto size : SIZES) {
+        const std::string DATA(size, 'x');
+        {
+            cluon::SharedMemoryRing producer{"/cluon-test-ring-6-" + std::to_string(size), 4, size};
+            REQUIRE(producer.valid());
+
+            std::atomic<uint32_t> received{0};
+            std::atomic<bool> running{true};
+            std::thread subscriberThread([&received, &running, size]() {
+                cluon::SharedMemoryRing subscriber{"/cluon-test-ring-6-" + std::to_string(size), 0, 0};
+                std::string data;
+                while (running.load()) {
+                    if (subscriber.pop(data, std::chrono::milliseconds(10))) {
+                        received++;
+                    }
+                }
+            });
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+            // Latency: wait for each entry to be received before sending the next one.
+            uint32_t completed{0};
+            const auto BEFORE{std::chrono::steady_clock::now()};
+            for (uint32_t i{0}; i < ITERATIONS; i++) {
+                const auto DEADLINE{std::chrono::steady_clock::now() + std::chrono::milliseconds(100)};
+                producer.push(DATA);
+                while ((received.load() == completed) && (std::chrono::steady_clock::now() < DEADLINE)) {}
+                completed = received.load();
+            }
+            const auto AFTER{std::chrono::steady_clock::now()};
+            running.store(false);
+            subscriberThread.join();
+
+            const auto DURATION{std::chrono::duration_cast<std::chrono::microseconds>(AFTER - BEFORE).count()};
+            std::clog << "SharedMemoryRing, " << size << " bytes: " << completed << "/" << ITERATIONS << " received, "
+                      << static_cast<double>(DURATION) / ITERATIONS << " microseconds per entry, "
+                      << (static_cast<double>(completed) * size) / (static_cast<double>(DURATION) + 1.0) << " MB/s." << std::endl;
+            REQUIRE(0 < completed);
+        }
+        if (size <= 60 * 1024) {
+            std::atomic<uint32_t> received{0};
+            cluon::UDPReceiver receiver{
+                "225.0.0.249", 12176, [&received](std::string &&, std::string &&, std::chrono::system_clock::time_point &&) { received++; }};
+            cluon::UDPSender sender{"225.0.0.249", 12176};
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+            uint32_t completed{0};
+            const auto BEFORE{std::chrono::steady_clock::now()};
+            for (uint32_t i{0}; i < ITERATIONS; i++) {
+                const auto DEADLINE{std::chrono::steady_clock::now() + std::chrono::milliseconds(100)};
+                sender.send(std::string(DATA));
+                while ((received.load() == completed) && (std::chrono::steady_clock::now() < DEADLINE)) {}
+                completed = received.load();
+            }
+            const auto AFTER{std::chrono::steady_clock::now()};
+
+            const auto DURATION{std::chrono::duration_cast<std::chrono::microseconds>(AFTER - BEFORE).count()};
+            std::clog << "UDP multicast, " << size << " bytes: " << completed << "/" << ITERATIONS << " received, "
+                      << static_cast<double>(DURATION) / ITERATIONS << " microseconds per entry, "
+                      << (static_cast<double>(completed) * size) / (static_cast<double>(DURATION) + 1.0) << " MB/s." << std::endl;
+        }
+    }
+#endif
+}
@@ -19,6 +19,7 @@
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 TEST_CASE("Creating UDPReceiver and stop immediately.") {
     cluon::UDPReceiver ur1{"127.0.0.1", 1234, nullptr};
@@ -97,6 +98,42 @@ TEST_CASE("Creating UDPReceiver and receive data.") {
     }
 }
 
+TEST_CASE("Creating UDPReceiver with socket filter to drop data in the kernel.") {
+#ifdef __linux__
+    std::atomic<uint32_t> received{0};
+    std::string lastData;
+    cluon::UDPReceiver ur4("127.0.0.1", 1238, [&received, &lastData](std::string &&d, std::string &&, std::chrono::system_clock::time_point &&) noexcept {
+        lastData = std::move(d);
+        received++;
+    });
+    REQUIRE(ur4.isRunning());
+
+    // Accept only datagrams starting with 'A'; the program sees the UDP header first.
+    const std::vector<cluon::UDPReceiver::FilterInstruction> PROGRAM{
+        {0x30 /* BPF_LD | BPF_B | BPF_ABS */, 0, 0, 8}, {0x15 /* BPF_JMP | BPF_JEQ | BPF_K */, 0, 1, 'A'}, {0x06 /* BPF_RET | BPF_K */, 0, 0, 0xFFFFFFFF}, {0x06, 0, 0, 0}};
+    REQUIRE(ur4.setSocketFilter(PROGRAM));
+
+    using namespace std::literals::chrono_literals; // NOLINT
+    cluon::UDPSender us3{"127.0.0.1", 1238};
+    us3.send("Bravo");
+    us3.send("Alpha");
+    int32_t maxWaitingIn1Millisecond{1000};
+    do { std::this_thread::sleep_for(1ms); } while ((0 == received.load()) && (maxWaitingIn1Millisecond-- > 0));
+    std::this_thread::sleep_for(50ms);
+    REQUIRE(1 == received.load());
+    REQUIRE("Alpha" == lastData);
+
+    // Detaching the filter twice succeeds.
+    REQUIRE(ur4.setSocketFilter({}));
+    REQUIRE(ur4.setSocketFilter({}));
+    us3.send("Bravo");
+    maxWaitingIn1Millisecond = 1000;
+    do { std::this_thread::sleep_for(1ms); } while ((1 == received.load()) && (maxWaitingIn1Millisecond-- > 0));
+    REQUIRE(2 == received.load());
+    REQUIRE("Bravo" == lastData);
+#endif
+}
+
 TEST_CASE("Testing multicast with 226.x.y.z address.") {
     // Setup data structures to receive data from UDPReceiver.
     std::atomic<bool> hasDataReceived{false};
@@ -13,6 +13,7 @@
 #include <cerrno>
 #include <string>
 #include <utility>
+#include <vector>
 
 // Defining a test fixture to be reused among the test cases.
 class TestFixture_UDPSender {
@@ -34,6 +35,16 @@ TEST_CASE_METHOD(TestFixture_UDPSender, "Send test data.") {
     REQUIRE(0 == retVal2.second);
 }
 
+TEST_CASE_METHOD(TestFixture_UDPSender, "Send test data with DSCP mark.") {
+    for (uint8_t dscp : std::vector<uint8_t>{46, 46, 0}) {
+        std::string TEST_DATA{"Hello World"};
+        const auto TEST_DATA_SIZE = TEST_DATA.size();
+        auto retVal2              = m_us.send(std::move(TEST_DATA), dscp);
+        REQUIRE(TEST_DATA_SIZE == static_cast<unsigned int>(retVal2.first));
+        REQUIRE(0 == retVal2.second);
+    }
+}
+
 TEST_CASE_METHOD(TestFixture_UDPSender, "Send empty data.") {
     std::string TEST_DATA;
     auto retVal2 = m_us.send(std::move(TEST_DATA));
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon/VarInt.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+TEST_CASE("Testing VarInt encoding and decoding at all byte boundaries.") {
+    std::vector<uint64_t> values{0, 1, 127, 128, 300, 16383, 16384, 2097151, 2097152, std::numeric_limits<uint64_t>::max()};
+    for (uint32_t bits{7}; bits < 64; bits += 7) {
+        values.push_back((1ull << bits) - 1);
+        values.push_back(1ull << bits);
+        values.push_back((1ull << bits) + 12345);
+    }
+
+    for (const auto v : values) {
+        char buffer[cluon::varint::MAX_SIZE];
+        const std::size_t SIZE{cluon::varint::encode(v, buffer)};
+        REQUIRE(cluon::varint::size(v) == SIZE);
+
+        // Reference encoding byte by byte.
+        std::string expected;
+        uint64_t w{v};
+        while (0x7f < w) {
+            expected.push_back(static_cast<char>((w & 0x7f) | 0x80));
+            w >>= 7;
+        }
+        expected.push_back(static_cast<char>(w));
+        REQUIRE(expected == std::string(buffer, SIZE));
+
+        // Decode with and without trailing bytes to exercise all paths.
+        for (std::size_t padding{0}; padding < 10; padding++) {
+            const std::string DATA{expected + std::string(padding, '\xff')};
+            uint64_t decoded{0};
+            REQUIRE(SIZE == cluon::varint::decode(DATA.data(), DATA.data() + DATA.size(), decoded));
+            REQUIRE(v == decoded);
+        }
+    }
+}
+
+TEST_CASE("Testing VarInt decoding of truncated and too long data.") {
+    uint64_t value{42};
+    const std::string TRUNCATED{"\x96\x96\x96", 3};
+    REQUIRE(0 == cluon::varint::decode(TRUNCATED.data(), TRUNCATED.data() + TRUNCATED.size(), value));
+    REQUIRE(0 == cluon::varint::decode(TRUNCATED.data(), TRUNCATED.data(), value));
+    REQUIRE(42 == value);
+
+    const std::string TOO_LONG(16, '\x80');
+    REQUIRE(0 == cluon::varint::decode(TOO_LONG.data(), TOO_LONG.data() + TOO_LONG.size(), value));
+    REQUIRE(42 == value);
+}
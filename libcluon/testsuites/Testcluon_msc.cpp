@@ -242,16 +242,16 @@ message testdata.MyTestMessage5 [id = 30005] {
 template<bool b>
 struct visitorSelector {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct visitorSelector<true> {
     template<typename T, class Visitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-        visitor.visit(fieldIdentifier, std::move(typeName), std::move(name), value);
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+        visitor.visit(fieldIdentifier, typeName, name, value);
     }
 };
 
@@ -260,9 +260,15 @@ struct isVisitable {
     static const bool value = false;
 };
 
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, visitor);
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template<typename T, class Visitor>
 void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, Visitor &visitor) {
-    visitorSelector<isVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, visitor);
+    doVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, visitor);
 }
 #endif
 
@@ -275,17 +281,17 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 template<bool b>
 struct tripletForwardVisitorSelector {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
 struct tripletForwardVisitorSelector<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -299,9 +305,15 @@ struct isTripletForwardVisitable {
     static const bool value = false;
 };
 
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+
+// Former visitor protocol passing type and field names as std::string.
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
 void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+    doTripletForwardVisit(fieldIdentifier, typeName.c_str(), name.c_str(), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -339,11 +351,13 @@ class LIB_API MyTestMessage5 {
         inline static int32_t ID() {
             return 30005;
         }
-        inline static const std::string ShortName() {
-            return TheShortName;
+        inline static const std::string &ShortName() {
+            static const std::string SHORT_NAME{TheShortName};
+            return SHORT_NAME;
         }
-        inline static const std::string LongName() {
-            return TheLongName;
+        inline static const std::string &LongName() {
+            static const std::string LONG_NAME{TheLongName};
+            return LONG_NAME;
         }
 
     public:
@@ -440,47 +454,47 @@ class LIB_API MyTestMessage5 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("uint8_t"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "uint8_t", "attribute1", m_attribute1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("int8_t"s), std::move("attribute2"s), m_attribute2, visitor);
+                doVisit(2, "int8_t", "attribute2", m_attribute2, visitor);
                 return;
             }
             if (3 == fieldId) {
-                doVisit(3, std::move("uint16_t"s), std::move("attribute3"s), m_attribute3, visitor);
+                doVisit(3, "uint16_t", "attribute3", m_attribute3, visitor);
                 return;
             }
             if (4 == fieldId) {
-                doVisit(4, std::move("int16_t"s), std::move("attribute4"s), m_attribute4, visitor);
+                doVisit(4, "int16_t", "attribute4", m_attribute4, visitor);
                 return;
             }
             if (5 == fieldId) {
-                doVisit(5, std::move("uint32_t"s), std::move("attribute5"s), m_attribute5, visitor);
+                doVisit(5, "uint32_t", "attribute5", m_attribute5, visitor);
                 return;
             }
             if (6 == fieldId) {
-                doVisit(6, std::move("int32_t"s), std::move("attribute6"s), m_attribute6, visitor);
+                doVisit(6, "int32_t", "attribute6", m_attribute6, visitor);
                 return;
             }
             if (7 == fieldId) {
-                doVisit(7, std::move("uint64_t"s), std::move("attribute7"s), m_attribute7, visitor);
+                doVisit(7, "uint64_t", "attribute7", m_attribute7, visitor);
                 return;
             }
             if (8 == fieldId) {
-                doVisit(8, std::move("int64_t"s), std::move("attribute8"s), m_attribute8, visitor);
+                doVisit(8, "int64_t", "attribute8", m_attribute8, visitor);
                 return;
             }
             if (9 == fieldId) {
-                doVisit(9, std::move("float"s), std::move("attribute9"s), m_attribute9, visitor);
+                doVisit(9, "float", "attribute9", m_attribute9, visitor);
                 return;
             }
             if (10 == fieldId) {
-                doVisit(10, std::move("double"s), std::move("attribute10"s), m_attribute10, visitor);
+                doVisit(10, "double", "attribute10", m_attribute10, visitor);
                 return;
             }
             if (11 == fieldId) {
-                doVisit(11, std::move("std::string"s), std::move("attribute11"s), m_attribute11, visitor);
+                doVisit(11, "std::string", "attribute11", m_attribute11, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -489,17 +503,17 @@ class LIB_API MyTestMessage5 {
         template<class Visitor>
         inline void accept(Visitor &visitor) {
             visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("uint8_t"s), std::move("attribute1"s), m_attribute1, visitor);
-            doVisit(2, std::move("int8_t"s), std::move("attribute2"s), m_attribute2, visitor);
-            doVisit(3, std::move("uint16_t"s), std::move("attribute3"s), m_attribute3, visitor);
-            doVisit(4, std::move("int16_t"s), std::move("attribute4"s), m_attribute4, visitor);
-            doVisit(5, std::move("uint32_t"s), std::move("attribute5"s), m_attribute5, visitor);
-            doVisit(6, std::move("int32_t"s), std::move("attribute6"s), m_attribute6, visitor);
-            doVisit(7, std::move("uint64_t"s), std::move("attribute7"s), m_attribute7, visitor);
-            doVisit(8, std::move("int64_t"s), std::move("attribute8"s), m_attribute8, visitor);
-            doVisit(9, std::move("float"s), std::move("attribute9"s), m_attribute9, visitor);
-            doVisit(10, std::move("double"s), std::move("attribute10"s), m_attribute10, visitor);
-            doVisit(11, std::move("std::string"s), std::move("attribute11"s), m_attribute11, visitor);
+            doVisit(1, "uint8_t", "attribute1", m_attribute1, visitor);
+            doVisit(2, "int8_t", "attribute2", m_attribute2, visitor);
+            doVisit(3, "uint16_t", "attribute3", m_attribute3, visitor);
+            doVisit(4, "int16_t", "attribute4", m_attribute4, visitor);
+            doVisit(5, "uint32_t", "attribute5", m_attribute5, visitor);
+            doVisit(6, "int32_t", "attribute6", m_attribute6, visitor);
+            doVisit(7, "uint64_t", "attribute7", m_attribute7, visitor);
+            doVisit(8, "int64_t", "attribute8", m_attribute8, visitor);
+            doVisit(9, "float", "attribute9", m_attribute9, visitor);
+            doVisit(10, "double", "attribute10", m_attribute10, visitor);
+            doVisit(11, "std::string", "attribute11", m_attribute11, visitor);
             visitor.postVisit();
         }
 
@@ -507,17 +521,17 @@ class LIB_API MyTestMessage5 {
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
             std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("uint8_t"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("int8_t"s), std::move("attribute2"s), m_attribute2, preVisit, visit, postVisit);
-            doTripletForwardVisit(3, std::move("uint16_t"s), std::move("attribute3"s), m_attribute3, preVisit, visit, postVisit);
-            doTripletForwardVisit(4, std::move("int16_t"s), std::move("attribute4"s), m_attribute4, preVisit, visit, postVisit);
-            doTripletForwardVisit(5, std::move("uint32_t"s), std::move("attribute5"s), m_attribute5, preVisit, visit, postVisit);
-            doTripletForwardVisit(6, std::move("int32_t"s), std::move("attribute6"s), m_attribute6, preVisit, visit, postVisit);
-            doTripletForwardVisit(7, std::move("uint64_t"s), std::move("attribute7"s), m_attribute7, preVisit, visit, postVisit);
-            doTripletForwardVisit(8, std::move("int64_t"s), std::move("attribute8"s), m_attribute8, preVisit, visit, postVisit);
-            doTripletForwardVisit(9, std::move("float"s), std::move("attribute9"s), m_attribute9, preVisit, visit, postVisit);
-            doTripletForwardVisit(10, std::move("double"s), std::move("attribute10"s), m_attribute10, preVisit, visit, postVisit);
-            doTripletForwardVisit(11, std::move("std::string"s), std::move("attribute11"s), m_attribute11, preVisit, visit, postVisit);
+            doTripletForwardVisit(1, "uint8_t", "attribute1", m_attribute1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "int8_t", "attribute2", m_attribute2, preVisit, visit, postVisit);
+            doTripletForwardVisit(3, "uint16_t", "attribute3", m_attribute3, preVisit, visit, postVisit);
+            doTripletForwardVisit(4, "int16_t", "attribute4", m_attribute4, preVisit, visit, postVisit);
+            doTripletForwardVisit(5, "uint32_t", "attribute5", m_attribute5, preVisit, visit, postVisit);
+            doTripletForwardVisit(6, "int32_t", "attribute6", m_attribute6, preVisit, visit, postVisit);
+            doTripletForwardVisit(7, "uint64_t", "attribute7", m_attribute7, preVisit, visit, postVisit);
+            doTripletForwardVisit(8, "int64_t", "attribute8", m_attribute8, preVisit, visit, postVisit);
+            doTripletForwardVisit(9, "float", "attribute9", m_attribute9, preVisit, visit, postVisit);
+            doTripletForwardVisit(10, "double", "attribute10", m_attribute10, preVisit, visit, postVisit);
+            doTripletForwardVisit(11, "std::string", "attribute11", m_attribute11, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
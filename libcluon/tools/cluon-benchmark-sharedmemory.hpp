@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_BENCHMARK_SHAREDMEMORY_HPP
+#define CLUON_BENCHMARK_SHAREDMEMORY_HPP
+
+#include "cluon/cluon.hpp"
+#include "cluon/Histogram.hpp"
+#include "cluon/SharedMemory.hpp"
+#include "cluon/Time.hpp"
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Header of every frame that is written by the producer.
+struct BenchmarkFrameHeader {
+    int64_t notifiedAt; // std::chrono::steady_clock in nanoseconds.
+    uint32_t stop;
+};
+
+// Results of one consumer that are passed to the producer via a pipe.
+struct BenchmarkConsumerResult {
+    uint64_t numberOfFrames{0};
+    uint64_t bytesCopied{0};
+    int64_t copyDuration{0}; // In nanoseconds.
+    uint32_t numberOfLatencies{0};
+};
+
+inline int64_t cluon_benchmark_now() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline bool cluon_benchmark_transfer(int fd, void *data, size_t length, bool isWriting) noexcept {
+    char *ptr{reinterpret_cast<char *>(data)};
+    while (0 < length) {
+        const ssize_t RETVAL{isWriting ? ::write(fd, ptr, length) : ::read(fd, ptr, length)};
+        if (0 >= RETVAL) {
+            return false;
+        }
+        ptr += RETVAL;
+        length -= static_cast<size_t>(RETVAL);
+    }
+    return true;
+}
+
+// Consumer: Wait for notifications, copy every frame out of the shared memory, and report the results.
+inline void cluon_benchmark_consumer(const std::string &name, int readyFd, int resultFd) noexcept {
+    std::vector<int64_t> latencies;
+    BenchmarkConsumerResult result;
+    {
+        cluon::SharedMemory sm{name};
+        if (sm.valid() && sm.registerReader()) {
+            std::vector<char> buffer(sm.size());
+            char ready{1};
+            cluon_benchmark_transfer(readyFd, &ready, sizeof(ready), true);
+
+            uint64_t lastFrame{0};
+            bool stop{false};
+            while (!stop) {
+                const bool NOTIFIED{sm.waitFor(std::chrono::milliseconds(50))};
+                const int64_t WOKEN_UP_AT{cluon_benchmark_now()};
+                const uint64_t FRAME{sm.frameCounter()};
+                if (FRAME == lastFrame) {
+                    // Bail out if the producer has vanished.
+                    stop = (1 == ::getppid());
+                    continue;
+                }
+
+                int64_t copyDuration{0};
+                BenchmarkFrameHeader header{0, 0};
+                sm.read([&buffer, &copyDuration, &header](const char *data, uint32_t size) {
+                    const int64_t START{cluon_benchmark_now()};
+                    std::memcpy(buffer.data(), data, size);
+                    copyDuration = cluon_benchmark_now() - START;
+                    std::memcpy(&header, buffer.data(), sizeof(BenchmarkFrameHeader));
+                });
+
+                stop = (0 != header.stop);
+                if (!stop) {
+                    result.numberOfFrames++;
+                    result.bytesCopied += sm.size();
+                    result.copyDuration += copyDuration;
+                    // Only frames that woke us up directly tell the notify-to-wakeup latency.
+                    if (NOTIFIED && (FRAME == lastFrame + 1)) {
+                        latencies.push_back(WOKEN_UP_AT - header.notifiedAt);
+                    }
+                }
+                lastFrame = FRAME;
+            }
+        }
+    }
+    result.numberOfLatencies = static_cast<uint32_t>(latencies.size());
+    cluon_benchmark_transfer(resultFd, &result, sizeof(result), true);
+    if (!latencies.empty()) {
+        cluon_benchmark_transfer(resultFd, latencies.data(), latencies.size() * sizeof(int64_t), true);
+    }
+}
+
+// Producer: Run one configuration and print one line of results.
+inline bool cluon_benchmark_run(const std::string &backend,
+                                bool useFutex,
+                                uint32_t numberOfConsumers,
+                                uint32_t payloadSize,
+                                uint32_t numberOfFrames,
+                                uint32_t pause,
+                                bool asJSON) noexcept {
+    ::setenv("CLUON_SHAREDMEMORY_POSIX", ("posix" == backend) ? "1" : "0", 1);
+
+    const std::string NAME{"/cluon-benchmark-sharedmemory-" + std::to_string(::getpid())};
+    const uint32_t SIZE{static_cast<uint32_t>(sizeof(BenchmarkFrameHeader)) + payloadSize};
+    cluon::SharedMemory::Options options;
+    options.futex = useFutex;
+    cluon::SharedMemory sm{NAME, SIZE, 0, options};
+    if (!sm.valid()) {
+        std::cerr << "[cluon-benchmark-sharedmemory] Failed to create shared memory '" << NAME << "' with " << SIZE << " bytes." << std::endl;
+        return false;
+    }
+    std::vector<char> payload(SIZE, 'x');
+
+    int readyPipe[2];
+    if (0 != ::pipe(readyPipe)) {
+        return false;
+    }
+    std::vector<pid_t> consumers;
+    std::vector<int> resultFds;
+    for (uint32_t i{0}; i < numberOfConsumers; i++) {
+        int resultPipe[2];
+        if (0 != ::pipe(resultPipe)) {
+            break;
+        }
+        const pid_t PID{::fork()};
+        if (0 == PID) {
+            ::close(readyPipe[0]);
+            ::close(resultPipe[0]);
+            cluon_benchmark_consumer(NAME, readyPipe[1], resultPipe[1]);
+            // Do not run the destructors of the producer's objects.
+            ::_exit(0);
+        }
+        ::close(resultPipe[1]);
+        if (0 > PID) {
+            ::close(resultPipe[0]);
+            break;
+        }
+        consumers.push_back(PID);
+        resultFds.push_back(resultPipe[0]);
+    }
+    ::close(readyPipe[1]);
+
+    // Wait for all consumers to be registered.
+    for (size_t i{0}; i < consumers.size(); i++) {
+        char ready{0};
+        cluon_benchmark_transfer(readyPipe[0], &ready, sizeof(ready), false);
+    }
+    ::close(readyPipe[0]);
+
+    auto writeFrame = [&sm, &payload](bool stop) {
+        BenchmarkFrameHeader header{0, stop ? 1u : 0u};
+        sm.lock();
+        sm.beginWrite();
+        std::memcpy(sm.data() + sizeof(BenchmarkFrameHeader), payload.data() + sizeof(BenchmarkFrameHeader), sm.size() - sizeof(BenchmarkFrameHeader));
+        header.notifiedAt = cluon_benchmark_now();
+        std::memcpy(sm.data(), &header, sizeof(BenchmarkFrameHeader));
+        sm.setTimeStamp(cluon::time::now());
+        sm.endWrite();
+        sm.unlock();
+        sm.notifyAll();
+    };
+    auto allConsumed = [&sm]() {
+        bool retVal{true};
+        for (const auto &reader : sm.readers()) {
+            retVal &= (0 == reader.lag);
+        }
+        return retVal;
+    };
+
+    // Frames per second are measured from writing a frame until all consumers have read it.
+    int64_t busy{0};
+    for (uint32_t i{0}; i < numberOfFrames; i++) {
+        // Give the consumers time to enter waiting again.
+        std::this_thread::sleep_for(std::chrono::microseconds(pause));
+        const int64_t START{cluon_benchmark_now()};
+        writeFrame(false);
+        const auto DEADLINE{std::chrono::steady_clock::now() + std::chrono::seconds(1)};
+        while (!allConsumed() && (std::chrono::steady_clock::now() < DEADLINE)) {
+            std::this_thread::yield();
+        }
+        busy += cluon_benchmark_now() - START;
+    }
+    writeFrame(true);
+
+    cluon::Histogram latencies;
+    uint64_t framesReceived{0};
+    uint64_t bytesCopied{0};
+    int64_t copyDuration{0};
+    for (size_t i{0}; i < consumers.size(); i++) {
+        BenchmarkConsumerResult result;
+        if (cluon_benchmark_transfer(resultFds[i], &result, sizeof(result), false)) {
+            std::vector<int64_t> values(result.numberOfLatencies);
+            if (values.empty() || cluon_benchmark_transfer(resultFds[i], values.data(), values.size() * sizeof(int64_t), false)) {
+                for (const auto v : values) {
+                    latencies.record(v);
+                }
+                framesReceived += result.numberOfFrames;
+                bytesCopied += result.bytesCopied;
+                copyDuration += result.copyDuration;
+            }
+        }
+        ::close(resultFds[i]);
+        int status{0};
+        ::waitpid(consumers[i], &status, 0);
+    }
+
+    const double P50{static_cast<double>(latencies.percentile(50.0)) / 1000.0};
+    const double P99{static_cast<double>(latencies.percentile(99.0)) / 1000.0};
+    const double FPS{(0 < busy) ? static_cast<double>(numberOfFrames) * 1e9 / static_cast<double>(busy) : 0.0};
+    const double MBPS{(0 < copyDuration) ? static_cast<double>(bytesCopied) * 1e3 / static_cast<double>(copyDuration) : 0.0};
+
+    std::stringstream sstr;
+    sstr << std::fixed << std::setprecision(3);
+    if (asJSON) {
+        sstr << "{\"backend\":\"" << backend << "\",\"futex\":" << (useFutex ? "true" : "false") << ",\"consumers\":" << consumers.size()
+             << ",\"size\":" << payloadSize << ",\"frames\":" << numberOfFrames << ",\"received\":" << framesReceived
+             << ",\"samples\":" << latencies.count() << ",\"p50_us\":" << P50 << ",\"p99_us\":" << P99 << ",\"fps\":" << FPS
+             << ",\"copy_MBps\":" << MBPS << "}";
+    } else {
+        sstr << backend << "," << (useFutex ? 1 : 0) << "," << consumers.size() << "," << payloadSize << "," << numberOfFrames << ","
+             << framesReceived << "," << latencies.count() << "," << P50 << "," << P99 << "," << FPS << "," << MBPS;
+    }
+    std::cout << sstr.str() << std::endl;
+    return consumers.size() == numberOfConsumers;
+}
+
+inline int32_t cluon_benchmark_sharedmemory(int32_t argc, char **argv) {
+    int32_t retCode{0};
+    auto commandlineArguments = cluon::getCommandlineArguments(argc, argv);
+    if (0 != commandlineArguments.count("help")) {
+        std::cerr << argv[0] << " measures notify-to-wakeup latency, frame rate, and copy bandwidth of cluon::SharedMemory between one producer and several consumer processes." << std::endl;
+        std::cerr << "Usage:   " << argv[0] << " [--consumers=<N>] [--frames=<frames per size>] [--min=<bytes>] [--max=<bytes>] [--backend=posix|sysv|all] [--futex[=all]] [--pause=<microseconds between frames>] [--json]" << std::endl;
+        std::cerr << "Example: " << argv[0] << " --consumers=2 --frames=100 --min=1024 --max=67108864 --backend=all" << std::endl;
+        std::cerr << "         " << argv[0] << " --consumers=1 --min=8 --max=8 --backend=all --futex=all  # Compare wakeup latencies with and without futex." << std::endl;
+        retCode = 1;
+    } else {
+        auto value = [&commandlineArguments](const std::string &key, uint32_t defaultValue) {
+            return (0 != commandlineArguments.count(key)) ? static_cast<uint32_t>(std::stoul(commandlineArguments[key])) : defaultValue;
+        };
+        const uint32_t CONSUMERS{value("consumers", 2)};
+        const uint32_t FRAMES{value("frames", 100)};
+        const uint32_t MIN{value("min", 1024)};
+        const uint32_t MAX{value("max", 64 * 1024 * 1024)};
+        const uint32_t PAUSE{value("pause", 1000)};
+        const std::string FUTEX{(0 != commandlineArguments.count("futex")) ? commandlineArguments["futex"] : ""};
+        const bool JSON{0 != commandlineArguments.count("json")};
+        const std::string BACKEND{(0 != commandlineArguments.count("backend")) ? commandlineArguments["backend"] : "all"};
+
+        std::vector<bool> notifications;
+        if (("all" == FUTEX) || FUTEX.empty()) {
+            notifications.push_back(false);
+        }
+        if (("all" == FUTEX) || !FUTEX.empty()) {
+            notifications.push_back(true);
+        }
+
+        std::vector<std::string> backends;
+        if (("all" == BACKEND) || ("posix" == BACKEND)) {
+            backends.push_back("posix");
+        }
+        if (("all" == BACKEND) || ("sysv" == BACKEND)) {
+            backends.push_back("sysv");
+        }
+
+        const char *PREVIOUS_SETTING{::getenv("CLUON_SHAREDMEMORY_POSIX")};
+        const std::string PREVIOUS{(nullptr != PREVIOUS_SETTING) ? PREVIOUS_SETTING : ""};
+
+        if (!JSON) {
+            std::cout << "backend,futex,consumers,size,frames,received,samples,p50_us,p99_us,fps,copy_MBps" << std::endl;
+        }
+        for (const auto &backend : backends) {
+            for (const bool useFutex : notifications) {
+                for (uint64_t size{(0 < MIN) ? MIN : 1}; size <= MAX; size *= 2) {
+                    if (!cluon_benchmark_run(backend, useFutex, CONSUMERS, static_cast<uint32_t>(size), FRAMES, PAUSE, JSON)) {
+                        retCode = 1;
+                    }
+                }
+            }
+        }
+
+        if (nullptr != PREVIOUS_SETTING) {
+            ::setenv("CLUON_SHAREDMEMORY_POSIX", PREVIOUS.c_str(), 1);
+        } else {
+            ::unsetenv("CLUON_SHAREDMEMORY_POSIX");
+        }
+    }
+    return retCode;
+}
+
+#endif
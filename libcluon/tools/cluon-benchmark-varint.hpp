@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_BENCHMARK_VARINT_HPP
+#define CLUON_BENCHMARK_VARINT_HPP
+
+#include "cluon/cluon.hpp"
+#include "cluon/VarInt.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Byte-at-a-time reference encoder as used before cluon::varint.
+inline std::size_t cluon_benchmark_varint_encodeBytewise(uint64_t v, char *out) noexcept {
+    std::size_t size{0};
+    while (0x7f < v) {
+        out[size++] = static_cast<char>((v & 0x7f) | 0x80);
+        v >>= 7;
+    }
+    out[size++] = static_cast<char>(v);
+    return size;
+}
+
+// Byte-at-a-time reference decoder as used before cluon::varint.
+inline std::size_t cluon_benchmark_varint_decodeBytewise(const char *data, const char *end, uint64_t &value) noexcept {
+    value = 0;
+    std::size_t size{0};
+    while ((data < end) && (size < cluon::varint::MAX_SIZE)) {
+        const uint64_t C{static_cast<uint8_t>(*data++)};
+        value |= (C & 0x7f) << (7 * size++);
+        if (C < 0x80) {
+            return size;
+        }
+    }
+    return 0;
+}
+
+inline std::vector<uint64_t> cluon_benchmark_varint_values(const std::string &distribution, uint32_t numberOfValues) noexcept {
+    std::vector<uint64_t> values;
+    std::mt19937_64 rng{0x0DA4};
+    values.reserve(numberOfValues);
+    for (uint32_t i{0}; i < numberOfValues; i++) {
+        const uint64_t R{rng()};
+        if ("small" == distribution) {
+            // Keys, ids, and counters that fit into one or two bytes.
+            values.push_back(R % ((0 == (i % 4)) ? (1u << 14) : (1u << 7)));
+        } else if ("large" == distribution) {
+            // Time stamps and hashes with at least 35 bits.
+            values.push_back(R | (1ull << (35 + (R % 29))));
+        } else {
+            // Random number of significant bits.
+            const uint32_t BITS{static_cast<uint32_t>(R % 65)};
+            values.push_back((64 == BITS) ? rng() : rng() & ((1ull << BITS) - 1));
+        }
+    }
+    return values;
+}
+
+inline int32_t cluon_benchmark_varint(int32_t argc, char **argv) {
+    int32_t retCode{0};
+    auto commandlineArguments = cluon::getCommandlineArguments(argc, argv);
+    if (0 != commandlineArguments.count("help")) {
+        std::cerr << argv[0] << " compares the VarInt kernels from cluon::varint with byte-at-a-time encoding and decoding." << std::endl;
+        std::cerr << "Usage:   " << argv[0] << " [--values=<N>] [--repetitions=<N>] [--json]" << std::endl;
+        std::cerr << "Example: " << argv[0] << " --values=1000000 --repetitions=10" << std::endl;
+        retCode = 1;
+    } else {
+        const uint32_t VALUES{(0 != commandlineArguments.count("values")) ? static_cast<uint32_t>(std::stoul(commandlineArguments["values"])) : 1000000};
+        const uint32_t REPETITIONS{(0 != commandlineArguments.count("repetitions")) ? static_cast<uint32_t>(std::stoul(commandlineArguments["repetitions"])) : 10};
+        const bool JSON{0 != commandlineArguments.count("json")};
+
+        if (!JSON) {
+            std::cout << "distribution,kernel,operation,values,bytes,ns_per_value,MBps" << std::endl;
+        }
+        for (const std::string distribution : {"small", "large", "random"}) {
+            const std::vector<uint64_t> VALUES_TO_ENCODE{cluon_benchmark_varint_values(distribution, VALUES)};
+            for (const std::string kernel : {"bytewise", "cluon"}) {
+                const bool BYTEWISE{"bytewise" == kernel};
+                std::vector<char> buffer(VALUES_TO_ENCODE.size() * cluon::varint::MAX_SIZE);
+                std::size_t bytes{0};
+                uint64_t checksum{0};
+
+                auto start = std::chrono::steady_clock::now();
+                for (uint32_t r{0}; r < REPETITIONS; r++) {
+                    bytes = 0;
+                    for (const auto v : VALUES_TO_ENCODE) {
+                        bytes += (BYTEWISE ? cluon_benchmark_varint_encodeBytewise(v, &buffer[bytes]) : cluon::varint::encode(v, &buffer[bytes]));
+                    }
+                }
+                const double ENCODE{static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count())};
+
+                start = std::chrono::steady_clock::now();
+                for (uint32_t r{0}; r < REPETITIONS; r++) {
+                    const char *data{buffer.data()};
+                    const char *end{buffer.data() + bytes};
+                    uint64_t value{0};
+                    std::size_t size{0};
+                    while (0 < (size = (BYTEWISE ? cluon_benchmark_varint_decodeBytewise(data, end, value) : cluon::varint::decode(data, end, value)))) {
+                        checksum += value;
+                        data += size;
+                    }
+                }
+                const double DECODE{static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count())};
+
+                uint64_t expected{0};
+                for (const auto v : VALUES_TO_ENCODE) {
+                    expected += v;
+                }
+                if (checksum != expected * REPETITIONS) {
+                    std::cerr << "[cluon-benchmark-varint] Decoded values differ for kernel " << kernel << " and distribution " << distribution << "." << std::endl;
+                    retCode = 1;
+                }
+
+                const double TOTAL_VALUES{static_cast<double>(VALUES_TO_ENCODE.size()) * REPETITIONS};
+                const double TOTAL_BYTES{static_cast<double>(bytes) * REPETITIONS};
+                for (const auto &result : {std::make_pair(std::string("encode"), ENCODE), std::make_pair(std::string("decode"), DECODE)}) {
+                    const double NS_PER_VALUE{(0 < TOTAL_VALUES) ? result.second / TOTAL_VALUES : 0.0};
+                    const double MBPS{(0 < result.second) ? TOTAL_BYTES * 1e3 / result.second : 0.0};
+                    std::stringstream sstr;
+                    sstr << std::fixed << std::setprecision(3);
+                    if (JSON) {
+                        sstr << "{\"distribution\":\"" << distribution << "\",\"kernel\":\"" << kernel << "\",\"operation\":\"" << result.first
+                             << "\",\"values\":" << VALUES_TO_ENCODE.size() << ",\"bytes\":" << bytes << ",\"ns_per_value\":" << NS_PER_VALUE
+                             << ",\"MBps\":" << MBPS << "}";
+                    } else {
+                        sstr << distribution << "," << kernel << "," << result.first << "," << VALUES_TO_ENCODE.size() << "," << bytes << ","
+                             << NS_PER_VALUE << "," << MBPS;
+                    }
+                    std::cout << sstr.str() << std::endl;
+                }
+            }
+        }
+    }
+    return retCode;
+}
+
+#endif
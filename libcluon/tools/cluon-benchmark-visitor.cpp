@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// This test for a compiler definition is necessary to preserve single-file, header-only compability.
+#ifndef HAVE_CLUON_BENCHMARK_VISITOR
+#include "cluon-benchmark-visitor.hpp"
+#endif
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// Count every heap allocation of this program.
+void *operator new(std::size_t size) {
+    cluon_benchmark_visitor_allocations()++;
+    void *ptr = std::malloc((0 < size) ? size : 1);
+    if (nullptr == ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+int32_t main(int32_t argc, char **argv) {
+    return cluon_benchmark_visitor(argc, argv);
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_BENCHMARK_VISITOR_HPP
+#define CLUON_BENCHMARK_VISITOR_HPP
+
+#include "cluon/cluon.hpp"
+#include "cluon/cluonDataStructures.hpp"
+#include "cluon/FromProtoVisitor.hpp"
+#include "cluon/ProtoSizeVisitor.hpp"
+#include "cluon/ToJSONVisitor.hpp"
+#include "cluon/ToProtoVisitor.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+// Number of heap allocations; counted by the replaced operator new in cluon-benchmark-visitor.cpp.
+inline uint64_t &cluon_benchmark_visitor_allocations() noexcept {
+    static uint64_t allocations{0};
+    return allocations;
+}
+
+// Adapter for a visitor that receives type and field names as std::string
+// like all visitors before names were passed as const char*.
+template <class Visitor>
+class cluon_benchmark_visitor_StringNames {
+   private:
+    cluon_benchmark_visitor_StringNames(const cluon_benchmark_visitor_StringNames &) = delete;
+    cluon_benchmark_visitor_StringNames(cluon_benchmark_visitor_StringNames &&)      = delete;
+    cluon_benchmark_visitor_StringNames &operator=(const cluon_benchmark_visitor_StringNames &) = delete;
+    cluon_benchmark_visitor_StringNames &operator=(cluon_benchmark_visitor_StringNames &&) = delete;
+
+   public:
+    explicit cluon_benchmark_visitor_StringNames(Visitor &visitor) noexcept
+        : m_visitor(visitor) {}
+
+    void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+        m_visitor.preVisit(id, shortName, longName);
+    }
+    void postVisit() noexcept {
+        m_visitor.postVisit();
+    }
+
+    template <typename T>
+    void visit(uint32_t id, std::string &&typeName, std::string &&name, T &value) noexcept {
+        m_visitor.visit(id, std::move(typeName), std::move(name), value);
+    }
+
+   private:
+    Visitor &m_visitor;
+};
+
+template <typename Run>
+inline void cluon_benchmark_visitor_measure(const std::string &message,
+                                            const std::string &visitor,
+                                            const std::string &names,
+                                            uint32_t iterations,
+                                            bool json,
+                                            Run &&run) noexcept {
+    // Warm up to let reused buffers reach their final capacity.
+    run();
+
+    const uint64_t ALLOCATIONS_BEFORE{cluon_benchmark_visitor_allocations()};
+    const auto START{std::chrono::steady_clock::now()};
+    for (uint32_t i{0}; i < iterations; i++) {
+        run();
+    }
+    const double DURATION{static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - START).count())};
+    const uint64_t ALLOCATIONS{cluon_benchmark_visitor_allocations() - ALLOCATIONS_BEFORE};
+
+    const double ALLOCATIONS_PER_MESSAGE{(0 < iterations) ? static_cast<double>(ALLOCATIONS) / iterations : 0.0};
+    const double NS_PER_MESSAGE{(0 < iterations) ? DURATION / iterations : 0.0};
+    std::stringstream sstr;
+    sstr << std::fixed << std::setprecision(3);
+    if (json) {
+        sstr << "{\"message\":\"" << message << "\",\"visitor\":\"" << visitor << "\",\"names\":\"" << names << "\",\"iterations\":" << iterations
+             << ",\"allocations_per_message\":" << ALLOCATIONS_PER_MESSAGE << ",\"ns_per_message\":" << NS_PER_MESSAGE << "}";
+    } else {
+        sstr << message << "," << visitor << "," << names << "," << iterations << "," << ALLOCATIONS_PER_MESSAGE << "," << NS_PER_MESSAGE;
+    }
+    std::cout << sstr.str() << std::endl;
+}
+
+template <typename T>
+inline void cluon_benchmark_visitor_run(T &msg, uint32_t iterations, bool json) noexcept {
+    const std::string MESSAGE{T::LongName()};
+
+    {
+        cluon::ToProtoVisitor protoEncoder;
+        cluon_benchmark_visitor_measure(MESSAGE, "ToProtoVisitor", "const char*", iterations, json, [&msg, &protoEncoder]() {
+            protoEncoder.reset();
+            msg.accept(protoEncoder);
+        });
+        cluon_benchmark_visitor_measure(MESSAGE, "ToProtoVisitor", "std::string", iterations, json, [&msg, &protoEncoder]() {
+            protoEncoder.reset();
+            cluon_benchmark_visitor_StringNames<cluon::ToProtoVisitor> stringNames{protoEncoder};
+            msg.accept(stringNames);
+        });
+    }
+    {
+        cluon_benchmark_visitor_measure(MESSAGE, "ProtoSizeVisitor", "const char*", iterations, json, [&msg]() {
+            cluon::ProtoSizeVisitor protoSize;
+            msg.accept(protoSize);
+        });
+        cluon_benchmark_visitor_measure(MESSAGE, "ProtoSizeVisitor", "std::string", iterations, json, [&msg]() {
+            cluon::ProtoSizeVisitor protoSize;
+            cluon_benchmark_visitor_StringNames<cluon::ProtoSizeVisitor> stringNames{protoSize};
+            msg.accept(stringNames);
+        });
+    }
+    {
+        cluon::ToProtoVisitor protoEncoder;
+        msg.accept(protoEncoder);
+        const std::string DATA{protoEncoder.encodedData()};
+
+        cluon::FromProtoVisitor protoDecoder;
+        T decoded;
+        cluon_benchmark_visitor_measure(MESSAGE, "FromProtoVisitor", "const char*", iterations, json, [&DATA, &protoDecoder, &decoded]() {
+            protoDecoder.decodeFrom(DATA.data(), DATA.size());
+            decoded.accept(protoDecoder);
+        });
+        cluon_benchmark_visitor_measure(MESSAGE, "FromProtoVisitor", "std::string", iterations, json, [&DATA, &protoDecoder, &decoded]() {
+            protoDecoder.decodeFrom(DATA.data(), DATA.size());
+            cluon_benchmark_visitor_StringNames<cluon::FromProtoVisitor> stringNames{protoDecoder};
+            decoded.accept(stringNames);
+        });
+    }
+    {
+        cluon_benchmark_visitor_measure(MESSAGE, "ToJSONVisitor", "const char*", iterations, json, [&msg]() {
+            cluon::ToJSONVisitor jsonEncoder;
+            msg.accept(jsonEncoder);
+        });
+        cluon_benchmark_visitor_measure(MESSAGE, "ToJSONVisitor", "std::string", iterations, json, [&msg]() {
+            cluon::ToJSONVisitor jsonEncoder;
+            cluon_benchmark_visitor_StringNames<cluon::ToJSONVisitor> stringNames{jsonEncoder};
+            msg.accept(stringNames);
+        });
+    }
+}
+
+inline int32_t cluon_benchmark_visitor(int32_t argc, char **argv) {
+    int32_t retCode{0};
+    auto commandlineArguments = cluon::getCommandlineArguments(argc, argv);
+    if (0 != commandlineArguments.count("help")) {
+        std::cerr << argv[0] << " counts heap allocations and time per message for visitors receiving type and field names as const char* or std::string."
+                  << std::endl;
+        std::cerr << "Usage:   " << argv[0] << " [--iterations=<N>] [--json]" << std::endl;
+        std::cerr << "Example: " << argv[0] << " --iterations=100000" << std::endl;
+        retCode = 1;
+    } else {
+        const uint32_t ITERATIONS{(0 != commandlineArguments.count("iterations")) ? static_cast<uint32_t>(std::stoul(commandlineArguments["iterations"]))
+                                                                                  : 100000};
+        const bool JSON{0 != commandlineArguments.count("json")};
+
+        if (!JSON) {
+            std::cout << "message,visitor,names,iterations,allocations_per_message,ns_per_message" << std::endl;
+        }
+
+        cluon::data::TimeStamp ts;
+        ts.seconds(1530000000).microseconds(123456);
+        cluon::data::Envelope envelope;
+        envelope.dataType(1001).serializedData(std::string(64, 'x')).sent(ts).received(ts).sampleTimeStamp(ts).senderStamp(7);
+        cluon_benchmark_visitor_run(envelope, ITERATIONS, JSON);
+
+        // Message with long field names.
+        cluon::data::EnvelopeStatistics statistics;
+        statistics.dataType(1001)
+            .senderStamp(7)
+            .numberOfEnvelopes(100000)
+            .rate(100.0f)
+            .transportLatencyP50(150)
+            .transportLatencyP99(900)
+            .transportLatencyMax(2500)
+            .sampleAgeP50(200)
+            .sampleAgeP99(1200)
+            .sampleAgeMax(3000)
+            .jitterP50(20)
+            .jitterP99(180)
+            .jitterMax(400)
+            .numberOfLostEnvelopes(3)
+            .numberOfDuplicatedEnvelopes(1)
+            .numberOfReorderedEnvelopes(2)
+            .lossRate(0.00003f);
+        cluon_benchmark_visitor_run(statistics, ITERATIONS, JSON);
+    }
+    return retCode;
+}
+
+#endif
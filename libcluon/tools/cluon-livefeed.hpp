@@ -10,6 +10,7 @@
 #define CLUON_LIVEFEED_HPP
 
 #include "cluon/cluon.hpp"
+#include "cluon/Envelope.hpp"
 #include "cluon/MetaMessage.hpp"
 #include "cluon/MessageParser.hpp"
 #include "cluon/OD4Session.hpp"
@@ -20,11 +21,13 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <unordered_map>
 #include <mutex>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <tuple>
 
 enum Color {
     RED     = 31,
@@ -85,10 +88,20 @@ inline int32_t cluon_livefeed(int32_t argc, char **argv) {
         std::unordered_map<int32_t, std::unordered_map<uint32_t, cluon::data::Envelope, cluon::UseUInt32ValueAsHashKey>, cluon::UseUInt32ValueAsHashKey> mapOfLastEnvelopes;
         std::unordered_map<int32_t, std::unordered_map<uint32_t, float>, cluon::UseUInt32ValueAsHashKey> mapOfUpdateRates;
 
+        // Statistics from OD4Sessions with an enabled monitor are shown separately
+        // per tupel (senderStamp of the Envelope, monitored dataType, monitored senderStamp).
+        std::map<std::tuple<uint32_t, int32_t, uint32_t>, std::pair<cluon::data::Envelope, cluon::data::EnvelopeStatistics>> mapOfLastStatistics;
+
         cluon::OD4Session od4Session(static_cast<uint16_t>(std::stoi(commandlineArguments["cid"])),
-            [&mapOfLastEnvelopesMutex, &mapOfLastEnvelopes, &mapOfUpdateRates](cluon::data::Envelope &&envelope) noexcept {
+            [&mapOfLastEnvelopesMutex, &mapOfLastEnvelopes, &mapOfUpdateRates, &mapOfLastStatistics](cluon::data::Envelope &&envelope) noexcept {
             std::lock_guard<std::mutex> lck(mapOfLastEnvelopesMutex);
 
+            if (cluon::data::EnvelopeStatistics::ID() == envelope.dataType()) {
+                auto stats = cluon::extractMessage<cluon::data::EnvelopeStatistics>(cluon::data::Envelope{envelope});
+                mapOfLastStatistics[std::make_tuple(envelope.senderStamp(), stats.dataType(), stats.senderStamp())] = std::make_pair(envelope, stats);
+                return;
+            }
+
             int64_t lastTimeStamp{0};
             int64_t currentTimeStamp{0};
             {
@@ -119,10 +132,20 @@ inline int32_t cluon_livefeed(int32_t argc, char **argv) {
         });
 
         if (od4Session.isRunning()) {
-            od4Session.timeTrigger(5, [&mapOfLastEnvelopesMutex, &mapOfLastEnvelopes, &mapOfUpdateRates, &scopeOfMetaMessages, &od4Session](){
+            od4Session.timeTrigger(5, [&mapOfLastEnvelopesMutex, &mapOfLastEnvelopes, &mapOfUpdateRates, &mapOfLastStatistics, &scopeOfMetaMessages, &od4Session](){
                 std::lock_guard<std::mutex> lck(mapOfLastEnvelopesMutex);
 
-                if (!mapOfLastEnvelopes.empty()) {
+                auto colorForAge = [](const cluon::data::Envelope &env) {
+                    const auto AGE{cluon::time::deltaInMicroseconds(cluon::time::now(), env.received())};
+
+                    Color c = Color::DEFAULT;
+                    if (AGE <= 2 * 1000 * 1000) { c = Color::GREEN; }
+                    if (AGE > 2 * 1000 * 1000 && AGE <= 5 * 1000 * 1000) { c = Color::YELLOW; }
+                    if (AGE > 5 * 1000 * 1000) { c = Color::RED; }
+                    return c;
+                };
+
+                if (!mapOfLastEnvelopes.empty() || !mapOfLastStatistics.empty()) {
                     clearScreen();
 
                     uint8_t y = 1;
@@ -146,16 +169,20 @@ inline int32_t cluon_livefeed(int32_t argc, char **argv) {
                             }
                             sstr << std::endl;
 
-                            const auto AGE{cluon::time::deltaInMicroseconds(cluon::time::now(), env.received())};
-
-                            Color c = Color::DEFAULT;
-                            if (AGE <= 2 * 1000 * 1000) { c = Color::GREEN; }
-                            if (AGE > 2 * 1000 * 1000 && AGE <= 5 * 1000 * 1000) { c = Color::YELLOW; }
-                            if (AGE > 5 * 1000 * 1000) { c = Color::RED; }
-
-                            writeText(c, y++, x, sstr.str());
+                            writeText(colorForAge(env), y++, x, sstr.str());
                         }
                     }
+                    for (const auto &e : mapOfLastStatistics) {
+                        const cluon::data::Envelope &env{e.second.first};
+                        const cluon::data::EnvelopeStatistics &stats{e.second.second};
+                        std::stringstream sstr;
+                        sstr << "Envelope: " << std::setfill(' ') << std::setw(5) << env.dataType() << std::setw(0) << "/" << env.senderStamp() << "; " << "sent: " << formatTimeStamp(env.sent()) << "; sample: " << formatTimeStamp(env.sampleTimeStamp())
+                             << "; " << stats.ShortName() << " for " << stats.dataType() << "/" << stats.senderStamp() << ": " << stats.rate() << " Hz"
+                             << ", latency p50/p99/max: " << stats.transportLatencyP50() << "/" << stats.transportLatencyP99() << "/" << stats.transportLatencyMax() << " us"
+                             << ", jitter p50/p99/max: " << stats.jitterP50() << "/" << stats.jitterP99() << "/" << stats.jitterMax() << " us" << std::endl;
+
+                        writeText(colorForAge(env), y++, x, sstr.str());
+                    }
                 }
                 return od4Session.isRunning();
             });
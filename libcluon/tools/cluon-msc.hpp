@@ -29,11 +29,13 @@ inline int32_t cluon_msc(int32_t argc, char **argv) {
     if (std::string::npos != inputFilename.find(PROGRAM)) {
         std::cerr << PROGRAM
                   << " transforms a given message specification file in .odvd format into C++." << std::endl;
-        std::cerr << "Usage:   " << PROGRAM << " [--cpp] [--proto] [--out=<file>] <odvd file>" << std::endl;
+        std::cerr << "Usage:   " << PROGRAM << " [--cpp [--protocodec]] [--proto] [--out=<file>] <odvd file>" << std::endl;
         std::cerr << "         " << PROGRAM << " --cpp:   Generate C++14-compliant, self-contained header file." << std::endl;
+        std::cerr << "         " << PROGRAM << " --protocodec: Add protoSize(), encodeProto(), and decodeProto() to the C++ messages." << std::endl;
         std::cerr << "         " << PROGRAM << " --proto: Generate Proto version2-compliant file." << std::endl;
         std::cerr << std::endl;
         std::cerr << "Example: " << PROGRAM << " --cpp --out=/tmp/myOutput.hpp myFile.odvd" << std::endl;
+        std::cerr << "         " << PROGRAM << " --cpp --protocodec --out=/tmp/myOutput.hpp myFile.odvd" << std::endl;
         return 1;
     }
 
@@ -41,6 +43,7 @@ inline int32_t cluon_msc(int32_t argc, char **argv) {
 
     const bool generateCPP = commandline[{"--cpp"}];
     const bool generateProto = commandline[{"--proto"}];
+    const bool generateProtoCodec = commandline[{"--protocodec"}];
 
     int retVal = 1;
     std::ifstream inputFile(inputFilename, std::ios::in);
@@ -60,7 +63,7 @@ inline int32_t cluon_msc(int32_t argc, char **argv) {
         for (auto e : result.first) {
             std::string content;
             if (generateCPP) {
-                cluon::MetaMessageToCPPTransformator transformation;
+                cluon::MetaMessageToCPPTransformator transformation(generateProtoCodec);
                 e.accept([&trans = transformation](const cluon::MetaMessage &_mm){ trans.visit(_mm); });
                 content = transformation.content();
             }
@@ -104,8 +104,7 @@ inline int32_t cluon_rec2csv(int32_t argc, char **argv) {
                     cluon::data::Envelope env{std::move(next.second)};
                     if (scope.count(env.dataType()) > 0) {
                         cluon::FromProtoVisitor protoDecoder;
-                        std::stringstream sstr(env.serializedData());
-                        protoDecoder.decodeFrom(sstr);
+                        protoDecoder.decodeFrom(env.serializedData().data(), env.serializedData().size());
 
                         cluon::MetaMessage m = scope[env.dataType()];
                         cluon::GenericMessage gm;